@@ -0,0 +1,54 @@
+#include "BenchNodes.hpp"
+
+namespace M3DS::Benchmark {
+    void BenchCounterA::update(Seconds<float>) {
+        ++count;
+    }
+
+    void BenchCounterA::hit() noexcept {
+        ++count;
+    }
+
+    Failure BenchCounterA::serialise(Serialiser& serialiser) const noexcept {
+        return SuperType::serialise(serialiser);
+    }
+
+    Failure BenchCounterA::deserialise(Deserialiser& deserialiser) noexcept {
+        return SuperType::deserialise(deserialiser);
+    }
+
+    void BenchCounterB::update(Seconds<float>) {
+        ++count;
+    }
+
+    Failure BenchCounterB::serialise(Serialiser& serialiser) const noexcept {
+        return SuperType::serialise(serialiser);
+    }
+
+    Failure BenchCounterB::deserialise(Deserialiser& deserialiser) noexcept {
+        return SuperType::deserialise(deserialiser);
+    }
+
+    void BenchCounterC::update(Seconds<float>) {
+        ++count;
+    }
+
+    Failure BenchCounterC::serialise(Serialiser& serialiser) const noexcept {
+        return SuperType::serialise(serialiser);
+    }
+
+    Failure BenchCounterC::deserialise(Deserialiser& deserialiser) noexcept {
+        return SuperType::deserialise(deserialiser);
+    }
+
+    REGISTER_METHODS(
+        BenchCounterA,
+
+        MUTABLE_METHOD(hit)
+    );
+    REGISTER_NO_MEMBERS(BenchCounterA);
+    REGISTER_NO_METHODS(BenchCounterB);
+    REGISTER_NO_MEMBERS(BenchCounterB);
+    REGISTER_NO_METHODS(BenchCounterC);
+    REGISTER_NO_MEMBERS(BenchCounterC);
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstdint>
+
+#include <m3ds/M3DS.hpp>
+
+namespace M3DS::Benchmark {
+    // Nodes whose update only bumps a counter, so timings measure dispatch rather than work.
+    class BenchCounterA : public Node {
+        M_CLASS(BenchCounterA, Node)
+    public:
+        std::uint32_t count {};
+
+        // A signal listener, bound so it can also be connected by name.
+        void hit() noexcept;
+    protected:
+        void update(Seconds<float> delta) override;
+    };
+
+    class BenchCounterB : public Node {
+        M_CLASS(BenchCounterB, Node)
+    public:
+        std::uint32_t count {};
+    protected:
+        void update(Seconds<float> delta) override;
+    };
+
+    class BenchCounterC : public Node {
+        M_CLASS(BenchCounterC, Node)
+    public:
+        std::uint32_t count {};
+    protected:
+        void update(Seconds<float> delta) override;
+    };
+
+    // Without their own M_CLASS, so Root updates them through virtual calls.
+    class VirtualCounterA final : public BenchCounterA {};
+    class VirtualCounterB final : public BenchCounterB {};
+    class VirtualCounterC final : public BenchCounterC {};
+
+    // Registered in place of the built-in pack.
+    using BenchTypes = BuiltinTypes::append<
+        BenchCounterA,
+        BenchCounterB,
+        BenchCounterC
+    >;
+}
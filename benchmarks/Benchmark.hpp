@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+extern "C" {
+    #include <3ds/os.h>
+    #include <3ds/svc.h>
+}
+
+#include <m3ds/utils/Debug.hpp>
+
+namespace M3DS::Benchmark {
+    using Run = void (*)();
+
+    struct Case {
+        std::string_view name {};
+        Run run {};
+    };
+
+    // Filled by each benchmark file during static initialisation.
+    [[nodiscard]] inline std::vector<Case>& getCases() {
+        static std::vector<Case> cases {};
+        return cases;
+    }
+
+    struct Register {
+        Register(const std::string_view name, const Run run) {
+            getCases().emplace_back(name, run);
+        }
+    };
+
+    // Stops the optimiser from dropping a result that is otherwise unused.
+    template <typename T>
+    void keep(const T& value) noexcept {
+        asm volatile("" : : "r"(&value) : "memory");
+    }
+
+    // Returns value as if it were only known at run time, so work depending on it cannot be folded away.
+    template <typename T>
+    [[nodiscard]] T opaque(T value) noexcept {
+        asm volatile("" : : "r"(&value) : "memory");
+        return value;
+    }
+
+    // Mean time of one call to func in microseconds, after an untimed warm-up call.
+    template <typename F>
+    [[nodiscard]] double measure(const std::size_t iterations, F&& func) {
+        func();
+
+        const std::uint64_t start = svcGetSystemTick();
+        for (std::size_t i{}; i < iterations; ++i)
+            func();
+        const std::uint64_t ticks = svcGetSystemTick() - start;
+
+        return static_cast<double>(ticks) * 1'000'000.0 / SYSCLOCK_ARM11 / static_cast<double>(iterations);
+    }
+
+    // Time of a single call to func in microseconds, for work that needs setting up again before each run.
+    template <typename F>
+    [[nodiscard]] double measureOnce(F&& func) {
+        const std::uint64_t start = svcGetSystemTick();
+        func();
+        const std::uint64_t ticks = svcGetSystemTick() - start;
+
+        return static_cast<double>(ticks) * 1'000'000.0 / SYSCLOCK_ARM11;
+    }
+
+    inline void report(const std::string_view label, const double microseconds) {
+        Debug::log("  {:<20}{:>10.1f} us", label, microseconds);
+    }
+
+    // Reports a baseline and the path replacing it, and how many times faster the latter is.
+    inline void compare(const std::string_view baselineLabel, const double baseline, const std::string_view label, const double microseconds) {
+        report(baselineLabel, baseline);
+        report(label, microseconds);
+        Debug::log("  {:<20}{:>10.2f} x", "speedup", baseline / microseconds);
+    }
+}
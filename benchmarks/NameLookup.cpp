@@ -0,0 +1,38 @@
+#include <algorithm>
+
+#include "Benchmark.hpp"
+#include "BenchNodes.hpp"
+
+namespace M3DS::Benchmark {
+    static constexpr std::size_t rounds = 1'000;
+
+    // About as many methods as the largest registered classes bind.
+    static constexpr std::array<std::string_view, 24> names {
+        "getPosition", "setPosition", "getRotation", "setRotation", "getScale", "setScale",
+        "getGlobalPosition", "setGlobalPosition", "translate", "rotate", "lookAt", "moveAndSlide",
+        "getVelocity", "setVelocity", "isOnFloor", "isOnWall", "isOnCeiling", "getFloorNormal",
+        "queueFree", "addToGroup", "removeFromGroup", "isInGroup", "getChildCount", "getParent"
+    };
+    static constexpr NameLookup<names.size()> lookup { names };
+
+    static void run() {
+        // The last names cost a linear search the most.
+        const double linear = measure(rounds, [] {
+            for (const std::string_view name : names)
+                keep(std::ranges::find(names, opaque(name)));
+        });
+        const double hashed = measure(rounds, [] {
+            for (const std::string_view name : names)
+                keep(lookup.find(opaque(name)));
+        });
+        compare("linear", linear, "perfect hash", hashed);
+
+        // Found one class up, as most script and animation lookups of inherited members are.
+        const double member = measure(rounds, [] {
+            keep(Registry::getMember(opaque(std::string_view{ "Timer" }), opaque(std::string_view{ "visible" })));
+        });
+        report("Registry::getMember", member);
+    }
+
+    static const Register registration { "Look up 24 method names", run };
+}
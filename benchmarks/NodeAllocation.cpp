@@ -0,0 +1,55 @@
+#include "Benchmark.hpp"
+#include "BenchNodes.hpp"
+
+namespace M3DS::Benchmark {
+    static constexpr std::size_t bullets = 256;
+    static constexpr std::size_t rounds = 20;
+
+    // The allocations of a wave of bullets, each a Sprite2D with an Area2D, freed together.
+    template <typename Allocate, typename Deallocate>
+    static double timeAllocations(Allocate allocate, Deallocate deallocate) {
+        std::vector<void*> sprites(bullets);
+        std::vector<void*> areas(bullets);
+
+        return measure(rounds, [&] {
+            for (std::size_t i{}; i < bullets; ++i) {
+                sprites[i] = allocate(sizeof(Sprite2D));
+                areas[i] = allocate(sizeof(Area2D));
+            }
+            for (std::size_t i{}; i < bullets; ++i) {
+                deallocate(areas[i], sizeof(Area2D));
+                deallocate(sprites[i], sizeof(Sprite2D));
+            }
+        });
+    }
+
+    static void run() {
+        const double heap = timeAllocations(
+            [](const std::size_t size) { return ::operator new(size); },
+            [](void* ptr, const std::size_t size) { ::operator delete(ptr, size); }
+        );
+        const double pooled = timeAllocations(
+            [](const std::size_t size) { return NodePool::allocate(size); },
+            [](void* ptr, const std::size_t size) { NodePool::deallocate(ptr, size); }
+        );
+        compare("heap", heap, "NodePool", pooled);
+
+        const std::unique_ptr<Root> root = std::make_unique<Root>();
+        Viewport* viewport = root->emplaceChild<Viewport>();
+        NodePool::reserve<Sprite2D>(bullets);
+        NodePool::reserve<Area2D>(bullets);
+
+        const double spawned = measure(rounds, [&] {
+            Node* wave = viewport->emplaceChild<Node>();
+            for (std::size_t i{}; i < bullets; ++i)
+                wave->emplaceChild<Sprite2D>()->emplaceChild<Area2D>();
+            viewport->removeChild(wave);
+        });
+        report("spawn and free", spawned);
+
+        const NodePool::Stats stats = NodePool::getStats<Sprite2D>();
+        Debug::log("  Sprite2D pool: {} slots, {} slabs, peak {}", stats.capacity, stats.slabs, stats.peak);
+    }
+
+    static const Register registration { "Spawn and free 256 bullets", run };
+}
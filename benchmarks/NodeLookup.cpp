@@ -0,0 +1,59 @@
+#include <format>
+
+#include "Benchmark.hpp"
+#include "BenchNodes.hpp"
+
+namespace M3DS::Benchmark {
+    static constexpr std::size_t width = 256;
+    static constexpr std::size_t lookups = 1'000;
+
+    // Path resolution as it was before names were interned: a string compare against every sibling in turn.
+    static const Node* scanPath(const Node* from, const NodePath& path) {
+        const Node* curr = from;
+        for (const std::string_view segment : path) {
+            if (!curr)
+                break;
+
+            if (segment == "..") {
+                curr = curr->getParent();
+                continue;
+            }
+
+            const Node* found {};
+            for (std::size_t i{}; i < curr->getChildCount(); ++i) {
+                if (const Node* child = curr->getChild(i); child->getName() == segment) {
+                    found = child;
+                    break;
+                }
+            }
+            curr = found;
+        }
+        return curr;
+    }
+
+    static void addChildren(Node& parent) {
+        for (std::size_t i{}; i < width; ++i)
+            parent.emplaceChild<Node>()->setName(std::format("Child{}", i));
+    }
+
+    static void run() {
+        const std::unique_ptr<Root> root = std::make_unique<Root>();
+        Node* level = root->emplaceChild<Node>();
+        addChildren(*level);
+        addChildren(*level->getChild(width - 1));
+        Node* from = level->getChild(0);
+
+        // The worst case for a scan, the last child at both levels.
+        const NodePath path { std::format("../Child{}/Child{}", width - 1, width - 1) };
+        const CompiledNodePath compiled { path };
+
+        const double scanned = measure(lookups, [&] { keep(scanPath(from, path)); });
+        const double indexed = measure(lookups, [&] { keep(from->getNode(path)); });
+        const double cached = measure(lookups, [&] { keep(from->getNode(compiled)); });
+
+        compare("string scan", scanned, "name index", indexed);
+        report("compiled, cached", cached);
+    }
+
+    static const Register registration { "Resolve a path in a 256 wide tree", run };
+}
@@ -0,0 +1,42 @@
+#include "Benchmark.hpp"
+#include "BenchNodes.hpp"
+
+namespace M3DS::Benchmark {
+    static constexpr std::size_t instances = 100;
+    static constexpr std::string_view prefabPath = "sdmc:/m3ds_bench_prefab.bin";
+
+    // An enemy made of a few dozen nodes of several classes.
+    static std::unique_ptr<Node> makePrefab() {
+        std::unique_ptr<Node> prefab = std::make_unique<Node>();
+        prefab->setName("Enemy");
+        for (std::size_t i{}; i < 8; ++i) {
+            Node2D* part = prefab->emplaceChild<Node2D>();
+            part->emplaceChild<Timer>();
+            part->emplaceChild<Node2D>()->emplaceChild<Node>();
+        }
+        return prefab;
+    }
+
+    static void run() {
+        const std::filesystem::path path { prefabPath };
+        if (Registry::serialise(*makePrefab(), path)) {
+            Debug::err("  Failed to write {}", prefabPath);
+            return;
+        }
+
+        PackedScene scene {};
+        if (scene.pack(path)) {
+            Debug::err("  Failed to pack {}", prefabPath);
+            return;
+        }
+
+        const double file = measure(instances, [&] { keep(Registry::deserialise<Node>(path)); });
+        const double packed = measure(instances, [&] { keep(scene.instantiate()); });
+        compare("file", file, "PackedScene", packed);
+
+        std::error_code error {};
+        std::filesystem::remove(path, error);
+    }
+
+    static const Register registration { "Instance a 33 node prefab", run };
+}
@@ -0,0 +1,32 @@
+#include "Benchmark.hpp"
+#include "BenchNodes.hpp"
+
+namespace M3DS::Benchmark {
+    static constexpr std::size_t emits = 1'000;
+    static constexpr std::array<std::size_t, 3> listenerCounts { 0, 1, 16 };
+
+    static void run() {
+        for (const std::size_t listenerCount : listenerCounts) {
+            const std::unique_ptr<Root> root = std::make_unique<Root>();
+            Signal direct {};
+            Signal reflective {};
+
+            for (std::size_t i{}; i < listenerCount; ++i) {
+                BenchCounterA* listener = root->emplaceChild<BenchCounterA>();
+                direct.connect<&BenchCounterA::hit>(*listener);
+                if (reflective.connect(*listener, "hit")) {
+                    Debug::err("  Failed to connect by name");
+                    return;
+                }
+            }
+
+            const double reflected = measure(emits, [&] { reflective.emit(); });
+            const double typed = measure(emits, [&] { direct.emit(); });
+
+            Debug::log("  {} listeners", listenerCount);
+            compare("reflective", reflected, "direct", typed);
+        }
+    }
+
+    static const Register registration { "Emit a signal", run };
+}
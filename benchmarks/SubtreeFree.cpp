@@ -0,0 +1,45 @@
+#include "Benchmark.hpp"
+#include "BenchNodes.hpp"
+
+namespace M3DS::Benchmark {
+    static constexpr std::size_t chunks = 100;
+    static constexpr std::size_t chunkSize = 100;
+    static constexpr std::size_t rounds = 10;
+
+    // Frees 10k nodes, 100 chunks of 100, each queued on its own as a level unload would.
+    template <typename Free>
+    static double timeFree(Free free) {
+        double total {};
+        for (std::size_t round{}; round < rounds; ++round) {
+            const std::unique_ptr<Root> root = std::make_unique<Root>();
+            Node* level = root->emplaceChild<Node>();
+
+            std::vector<Node*> nodes {};
+            nodes.reserve(chunks * chunkSize);
+            for (std::size_t i{}; i < chunks; ++i) {
+                Node2D* chunk = level->emplaceChild<Node2D>();
+                for (std::size_t j{}; j + 1 < chunkSize; ++j)
+                    nodes.emplace_back(chunk->emplaceChild<Node2D>());
+                nodes.emplace_back(chunk);
+            }
+
+            total += measureOnce([&] { free(*root, nodes); });
+        }
+        return total / static_cast<double>(rounds);
+    }
+
+    static void run() {
+        const double oneByOne = timeFree([](Root&, const std::vector<Node*>& nodes) {
+            for (Node* node : nodes)
+                node->free();
+        });
+        const double batched = timeFree([](Root& root, const std::vector<Node*>& nodes) {
+            for (Node* node : nodes)
+                node->queueFree();
+            root.flushFreeQueue();
+        });
+        compare("one by one", oneByOne, "free queue", batched);
+    }
+
+    static const Register registration { "Free 10k nodes", run };
+}
@@ -0,0 +1,140 @@
+#include <ranges>
+#include <unordered_map>
+
+#include "Benchmark.hpp"
+#include "BenchNodes.hpp"
+
+namespace M3DS::Benchmark {
+    static constexpr std::size_t chunks = 100;
+    static constexpr std::size_t chunkSize = 100;
+    static constexpr std::size_t walks = 100;
+
+    // Node's own fields in the order they had before the hot/cold split, as the baseline.
+    struct UnsplitLayout {
+        virtual ~UnsplitLayout() = default;
+
+        bool visible = true;
+        bool helper {};
+        bool freeing {};
+        NodeName name {};
+        UnsplitLayout* parent {};
+        Root* root {};
+        Viewport* viewport {};
+        const CanvasLayer* canvasLayer {};
+        std::vector<UnsplitLayout*> children {};
+        std::unique_ptr<std::unordered_map<NodeName, std::size_t>> childIndex {};
+        std::uint32_t handleIndex {};
+        std::vector<std::pair<NodeName, std::uint32_t>> groups {};
+        std::uint16_t instanceList {};
+        std::uint32_t instanceSlot {};
+        std::uint32_t queuedCalls {};
+        std::unique_ptr<BaseScript> script {};
+        bool scriptHandlesInput {};
+        bool inputListener {};
+        Node::ProcessMode processMode {};
+        std::uint8_t processState {};
+        int processPriority {};
+        std::size_t updateSlot {};
+        std::uint16_t updateBucket {};
+    };
+
+    // The same fields as Node now lays them out, with the rarely changed ones behind a pointer.
+    struct SplitLayout {
+        virtual ~SplitLayout() = default;
+
+        bool visible = true;
+        SplitLayout* parent {};
+        Root* root {};
+        std::vector<SplitLayout*> children {};
+        std::unique_ptr<BaseScript> script {};
+        Viewport* viewport {};
+        const CanvasLayer* canvasLayer {};
+        std::uint32_t updateSlot {};
+        std::uint16_t updateBucket {};
+        std::uint8_t processState {};
+        std::uint8_t flags {};
+        NodeName name {};
+        std::uint32_t subtreeGeneration {};
+        std::uint16_t instanceList {};
+        std::uint32_t instanceSlot {};
+        std::uint32_t inputSlot {};
+        std::uint32_t coroutines {};
+        std::uint32_t handleIndex {};
+        std::unique_ptr<std::unordered_map<NodeName, std::size_t>> childIndex {};
+        std::unique_ptr<std::vector<std::pair<NodeName, std::uint32_t>>> cold {};
+    };
+
+    // Lays the nodes out contiguously in creation order, as NodePool does, in the same shape as the real tree.
+    template <typename Layout>
+    static std::vector<Layout> buildLayout() {
+        std::vector<Layout> nodes(1 + chunks * chunkSize);
+        std::size_t next = 1;
+        for (std::size_t i{}; i < chunks; ++i) {
+            Layout& chunk = nodes[next++];
+            chunk.parent = &nodes.front();
+            nodes.front().children.emplace_back(&chunk);
+            for (std::size_t j{}; j + 1 < chunkSize; ++j) {
+                Layout& node = nodes[next++];
+                node.parent = &chunk;
+                chunk.children.emplace_back(&node);
+            }
+        }
+        return nodes;
+    }
+
+    template <typename Layout>
+    static double timeLayoutWalk(const Layout& top) {
+        std::vector<const Layout*> pending {};
+        return measure(walks, [&] {
+            std::size_t visible {};
+            pending.emplace_back(&top);
+            while (!pending.empty()) {
+                const Layout* node = pending.back();
+                pending.pop_back();
+                visible += node->visible;
+                for (const Layout* child : node->children | std::views::reverse)
+                    pending.emplace_back(child);
+            }
+            keep(visible);
+        });
+    }
+
+    template <TreeOrder Order>
+    static double timeWalk(Node& subtree) {
+        return measure(walks, [&] {
+            std::size_t visible {};
+            for (const Node& node : subtree.walk<Order>())
+                visible += node.visible;
+            keep(visible);
+        });
+    }
+
+    static void run() {
+        const std::unique_ptr<Root> root = std::make_unique<Root>();
+        Node* level = root->emplaceChild<Node>();
+
+        // Classes mixed, so nodes are spread over several pools as in a real scene.
+        for (std::size_t i{}; i < chunks; ++i) {
+            Node2D* chunk = level->emplaceChild<Node2D>();
+            for (std::size_t j{}; j + 1 < chunkSize; ++j) {
+                switch (j % 3) {
+                    case 0: chunk->emplaceChild<Node2D>(); break;
+                    case 1: chunk->emplaceChild<Timer>(); break;
+                    default: chunk->emplaceChild<Node>(); break;
+                }
+            }
+        }
+
+        Debug::log("  sizeof(Node) {} bytes", sizeof(Node));
+        report("preorder", timeWalk<TreeOrder::preorder>(*level));
+        report("breadth first", timeWalk<TreeOrder::breadth_first>(*level));
+
+        // Only the node layout differs between these two walks, isolating what the split gains.
+        const std::vector<UnsplitLayout> unsplit = buildLayout<UnsplitLayout>();
+        const std::vector<SplitLayout> split = buildLayout<SplitLayout>();
+        Debug::log("  unsplit {} bytes, hot/cold {} bytes", sizeof(UnsplitLayout), sizeof(SplitLayout));
+        compare("unsplit layout", timeLayoutWalk(unsplit.front()), "hot/cold layout", timeLayoutWalk(split.front()));
+    }
+
+    static const Register registration { "Walk a 10k node tree", run };
+}
@@ -0,0 +1,30 @@
+#include "Benchmark.hpp"
+#include "BenchNodes.hpp"
+
+namespace M3DS::Benchmark {
+    static constexpr std::size_t nodeCount = 10'000;
+    static constexpr std::size_t frames = 100;
+
+    // Classes interleaved, as they are in a scene built in spawn order.
+    template <typename A, typename B, typename C>
+    static double timeUpdates() {
+        const std::unique_ptr<Root> root = std::make_unique<Root>();
+        for (std::size_t i{}; i < nodeCount; ++i) {
+            switch (i % 3) {
+                case 0: root->emplaceChild<A>(); break;
+                case 1: root->emplaceChild<B>(); break;
+                default: root->emplaceChild<C>(); break;
+            }
+        }
+
+        return measure(frames, [&] { root->treeUpdate(1.f / 60.f); });
+    }
+
+    static void run() {
+        const double virtualCalls = timeUpdates<VirtualCounterA, VirtualCounterB, VirtualCounterC>();
+        const double batched = timeUpdates<BenchCounterA, BenchCounterB, BenchCounterC>();
+        compare("virtual calls", virtualCalls, "class batches", batched);
+    }
+
+    static const Register registration { "Update 10k mixed nodes", run };
+}
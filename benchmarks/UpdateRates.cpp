@@ -0,0 +1,47 @@
+#include <algorithm>
+
+#include "Benchmark.hpp"
+#include "BenchNodes.hpp"
+
+namespace M3DS::Benchmark {
+    static constexpr std::size_t nodeCount = 10'000;
+    static constexpr std::size_t frames = 60;
+    static constexpr std::uint8_t interval = 4;
+
+    // Mean and worst frame, as the point of update rates is a flat per-frame cost.
+    template <typename Configure>
+    static void timeFrames(const std::string_view label, Configure configure) {
+        const std::unique_ptr<Root> root = std::make_unique<Root>();
+        for (std::size_t i{}; i < nodeCount; ++i)
+            configure(*root, *root->emplaceChild<BenchCounterA>());
+
+        // Lets every bucket go through a full cycle of phases first.
+        for (std::size_t i{}; i < interval; ++i)
+            root->treeUpdate(1.f / 60.f);
+
+        double total {};
+        double worst {};
+        for (std::size_t i{}; i < frames; ++i) {
+            const double frame = measureOnce([&] { root->treeUpdate(1.f / 60.f); });
+            total += frame;
+            worst = std::max(worst, frame);
+        }
+
+        Debug::log("  {}", label);
+        report("mean frame", total / static_cast<double>(frames));
+        report("worst frame", worst);
+    }
+
+    static void run() {
+        timeFrames("every frame", [](Root&, Node&) {});
+        timeFrames("every 4th frame", [](Root&, Node& node) {
+            node.setUpdateInterval(interval);
+        });
+        timeFrames("budget of 2500", [](Root& root, Node& node) {
+            root.setUpdateBudget(static_cast<std::uint32_t>(nodeCount / interval));
+            node.setUpdateRate(Node::UpdateRate::budgeted);
+        });
+    }
+
+    static const Register registration { "Update 10k nodes at reduced rates", run };
+}
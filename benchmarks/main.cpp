@@ -0,0 +1,22 @@
+#include <m3ds/M3DS.hpp>
+
+#include "Benchmark.hpp"
+#include "BenchNodes.hpp"
+
+// Runs every registered benchmark once and prints its timings to the console.
+int main() {
+    M3DS::Init _ {};
+    M3DS::Registry::registerTypePack(M3DS::Benchmark::BenchTypes{});
+
+    for (const auto& [name, run] : M3DS::Benchmark::getCases()) {
+        M3DS::Debug::log("{}", name);
+        run();
+    }
+
+    M3DS::Debug::log("Done. Press START to exit.");
+    while (aptMainLoop()) {
+        hidScanInput();
+        if (hidKeysDown() & KEY_START)
+            break;
+    }
+}
@@ -58,9 +58,61 @@
 #include <m3ds/utils/Debug.hpp>
 #include <m3ds/utils/Visitor.hpp>
 
+#include <m3ds/reference/resource/PackedScene.hpp>
 #include <m3ds/reference/resource/TileSet.hpp>
 
 namespace M3DS {
+    // Every built-in node type, registered through one table sorted at compile time.
+    // User types can be registered alongside with BuiltinTypes::append<...>.
+    using BuiltinTypes = TypePack<
+        Area2D,
+        Camera2D,
+        CollisionObject2D,
+        KinematicBody2D,
+        Node2D,
+        Particles2D,
+        PhysicsBody2D,
+        Sprite2D,
+        StaticBody2D,
+        Area3D,
+        BoneAttachment3D,
+        Camera3D,
+        CollisionObject3D,
+        KinematicBody3D,
+        Light3D,
+        MeshInstance,
+        Node3D,
+        PhysicsBody3D,
+        Sprite3D,
+        StaticBody3D,
+        BoxContainer,
+        CentreContainer,
+        Container,
+        FillContainer,
+        HBoxContainer,
+        MarginContainer,
+        PanelContainer,
+        ScrollContainer,
+        VBoxContainer,
+        Button,
+        Label,
+        Panel,
+        ProgressBar,
+        TextureRect,
+        UINode,
+        AnimationPlayer,
+        AudioPlayer,
+        CanvasItem,
+        CanvasLayer,
+        Node,
+        Root,
+        Timer,
+        Tween,
+        Viewport,
+        Object
+        // BaseScript
+    >;
+
 #ifdef __3DS__
     enum class Console {
         top,
@@ -146,58 +198,11 @@ namespace M3DS {
 #endif
 
             Registry::clear();
-            Registry::registerTypes<
-                Object,
-                Area2D,
-                Camera2D,
-                CollisionObject2D,
-                KinematicBody2D,
-                Node2D,
-                Particles2D,
-                PhysicsBody2D,
-                Sprite2D,
-                StaticBody2D,
-                Area3D,
-                BoneAttachment3D,
-                Camera3D,
-                CollisionObject3D,
-                KinematicBody3D,
-                Light3D,
-                MeshInstance,
-                Node3D,
-                PhysicsBody3D,
-                Sprite3D,
-                StaticBody3D,
-                BoxContainer,
-                CentreContainer,
-                Container,
-                FillContainer,
-                HBoxContainer,
-                MarginContainer,
-                PanelContainer,
-                ScrollContainer,
-                VBoxContainer,
-                Button,
-                Label,
-                Panel,
-                ProgressBar,
-                TextureRect,
-                UINode,
-                AnimationPlayer,
-                AudioPlayer,
-                CanvasItem,
-                CanvasLayer,
-                Node,
-                Root,
-                Timer,
-                Tween,
-                Viewport,
-                Object
-                // BaseScript
-            >();
+            Registry::registerTypePack(BuiltinTypes{});
 
             ResourceRegistry::registerResources<
                 Font,
+                PackedScene,
                 ParticleMaterial2D,
                 TileSet,
                 Resource
@@ -24,6 +24,7 @@ namespace M3DS {
     protected:
         void update(Seconds<float> delta) override;
         void draw(RenderTarget2D& target) override;
+        [[nodiscard]] bool isRecordable() const noexcept override;
     private:
         float mTimer = 0;
         std::size_t mNewestParticle = 0;
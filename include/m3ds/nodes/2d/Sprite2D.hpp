@@ -14,5 +14,6 @@ namespace M3DS {
         explicit Sprite2D(SpriteSheet sheet) noexcept;
     protected:
         void draw(RenderTarget2D& target) override;
+        void record(RenderSnapshot& snapshot) const override;
     };
 }
@@ -6,6 +6,7 @@
 namespace M3DS {
     class MeshInstance : public Node3D {
         M_CLASS(MeshInstance, Node3D)
+        friend class Root;
     public:
         struct BoneInstance {
             Matrix4x4 transform = Matrix4x4::identity();
@@ -63,7 +64,10 @@ namespace M3DS {
         [[nodiscard]] std::size_t getAnimationCount() const noexcept;
     protected:
         void draw(RenderTarget3D& target) override;
-        void update(Seconds<float> delta) override;
+        void record(RenderSnapshot& snapshot) const override;
+
+        void afterTreeEnter() override;
+        void beforeTreeExit() override;
     private:
         std::shared_ptr<const Mesh> mMesh {};
         HeapArray<BoneInstance, std::uint16_t> mBones {};
@@ -81,7 +85,16 @@ namespace M3DS {
             bool paused {};
         } mAnimationData {};
 
+        // Time processed since the pose was last evaluated, for instances updating less than every frame.
+        Seconds<float> mAnimationElapsed {};
+
+        // Whether the instance has an animation to play and is processing, regardless of its update rate.
+        [[nodiscard]] bool isAnimationDue() const noexcept;
+
+        // Poses are evaluated by Root in a parallel pass: updateProgress() runs serially on the
+        // thread updating the tree, then updatePose() may run on any worker as it only writes this instance's bones.
         void updateProgress(Seconds<float> delta) noexcept;
+        void updatePose() noexcept;
         template <bool blend>
         void updateBone(std::uint16_t bone) noexcept;
     };
@@ -2,6 +2,7 @@
 
 #include <m3ds/nodes/Node.hpp>
 #include <m3ds/spatial/Matrix4x4.hpp>
+#include <m3ds/spatial/TransformHierarchy.hpp>
 
 namespace M3DS {
     class Node3D : public Node {
@@ -24,11 +25,16 @@ namespace M3DS {
         void setGlobalTransform(const Matrix4x4& to) noexcept;
         void setGlobalTranslation(const Metres<Vector3>& to) noexcept;
         void setGlobalRotation(const Quaternion& to);
+    protected:
+        void afterTreeEnter() override;
+        void beforeTreeExit() override;
     private:
         Matrix4x4 mTransform = Matrix4x4::identity();
+        // Index into Root's transform hierarchy while in the tree.
+        TransformHierarchy3D::Index mTransformIndex = TransformHierarchy3D::noIndex;
+        // Only used outside the tree, where the global transform is recomputed on every call.
         mutable Matrix4x4 mGlobalTransform = Matrix4x4::identity();
-        mutable bool mGlobalTransformDirty {};
 
-        void setGlobalTransformDirty() noexcept;
+        void transformChanged() noexcept;
     };
 }
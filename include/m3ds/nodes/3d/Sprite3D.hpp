@@ -17,5 +17,6 @@ namespace M3DS {
         explicit Sprite3D(SpriteSheet sheet) noexcept;
     protected:
         void draw(RenderTarget3D& target) override;
+        void record(RenderSnapshot& snapshot) const override;
     };
 }
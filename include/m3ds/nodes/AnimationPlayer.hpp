@@ -93,6 +93,8 @@ namespace M3DS {
         Seconds<float> elapsed {};
         bool completed {};
         bool active = true;
+        // Compiled per layer rather than in the shared Animation, so players never overwrite each other's cached resolutions.
+        std::vector<CompiledNodePath> paths {};
     };
 
     class AnimationPlayer : public Node {
@@ -363,7 +365,7 @@ namespace M3DS {
         );
 
         if (trackIt == mAnimationEntries.end()) {
-            std::vector<AnimationTrackVariant>& vec = mAnimationEntries.emplace_back(path).tracks;
+            std::vector<AnimationTrackVariant>& vec = mAnimationEntries.emplace_back(path, std::vector<AnimationTrackVariant>{}).tracks;
             return &std::get<AnimationTrack<T>>(vec.emplace_back(AnimationTrack<T>{ member }));
         }
 
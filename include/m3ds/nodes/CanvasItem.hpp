@@ -2,6 +2,7 @@
 
 #include <m3ds/nodes/Node.hpp>
 #include <m3ds/spatial/Transform2D.hpp>
+#include <m3ds/spatial/TransformHierarchy.hpp>
 
 namespace M3DS {
     class CanvasItem : public Node {
@@ -26,10 +27,11 @@ namespace M3DS {
         void beforeTreeExit() override;
     private:
         Transform2D mTransform {};
-
+        // Index into Root's transform hierarchy while in the tree.
+        TransformHierarchy2D::Index mTransformIndex = TransformHierarchy2D::noIndex;
+        // Only used outside the tree, where the global transform is recomputed on every call.
         mutable Transform2D mGlobalTransform {};
-        mutable bool mGlobalTransformDirty {};
 
-        void setGlobalTransformDirty() noexcept;
+        void transformChanged() noexcept;
     };
 }
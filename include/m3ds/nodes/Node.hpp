@@ -1,24 +1,35 @@
 #pragma once
 
+#include <limits>
 #include <memory>
-#include <queue>
 #include <vector>
+#include <span>
 #include <string>
+#include <unordered_map>
 
 #include <m3ds/reference/Object.hpp>
 #include <m3ds/reference/Script.hpp>
 
+#include <m3ds/nodes/TreeWalk.hpp>
+
 #include <m3ds/types/Notification.hpp>
 #include <m3ds/types/NodePath.hpp>
+#include <m3ds/types/NodeName.hpp>
+#include <m3ds/types/NodeHandle.hpp>
+#include <m3ds/types/CompiledNodePath.hpp>
 
+#include <m3ds/utils/CallQueue.hpp>
+#include <m3ds/utils/Coroutine.hpp>
 #include <m3ds/utils/Memory.hpp>
+#include <m3ds/utils/NodePool.hpp>
+#include <m3ds/utils/TimerWheel.hpp>
 
 namespace M3DS {
     class Root;
     class CanvasLayer;
     class Viewport;
     class Frame;
-    class BaseSignal;
+    class RenderSnapshot;
 
     class Node : public Object {
         M_CLASS(Node, Object)
@@ -26,10 +37,31 @@ namespace M3DS {
         friend class CanvasLayer;
         friend class Viewport;
 
-        friend class BaseSignal;
+        friend class CoroutineScheduler;
+
+        template <typename, TreeOrder, bool>
+        friend class TreeWalk;
     public:
+        // How a node takes part in treeUpdate. A paused subtree still updates descendants set to always,
+        // while a disabled one never updates.
+        enum class ProcessMode : std::uint8_t {
+            inherit,
+            always,
+            paused,
+            disabled
+        };
+
+        // How often Root updates a node. Whatever the rate, update receives the time since the node last updated.
+        enum class UpdateRate : std::uint8_t {
+            // Every getUpdateInterval() frames, with the nodes of a class spread evenly over those frames.
+            interval,
+            // In turn with the other budgeted nodes of its class and priority, up to Root's update budget per frame.
+            budgeted,
+            // At an interval Root picks from the distance of a Node3D to its viewport's camera.
+            distance
+        };
+
         bool visible = true;
-        // bool paused = false;
 
         [[nodiscard]] std::span<const std::unique_ptr<Node>> getChildren() noexcept;
 
@@ -45,6 +77,16 @@ namespace M3DS {
         Node(Node&&) = delete;
         Node& operator=(Node&&) = delete;
 
+        // Every node, whichever way it is created, is allocated from NodePool.
+        [[nodiscard]] static void* operator new(std::size_t size);
+        [[nodiscard]] static void* operator new(std::size_t size, const std::nothrow_t&) noexcept;
+        static void operator delete(void* ptr, std::size_t size) noexcept;
+
+        // Over-aligned nodes bypass the pool.
+        [[nodiscard]] static void* operator new(std::size_t size, std::align_val_t alignment);
+        [[nodiscard]] static void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept;
+        static void operator delete(void* ptr, std::size_t size, std::align_val_t alignment) noexcept;
+
         [[nodiscard]] Node* getParent() noexcept;
         [[nodiscard]] const Node* getParent() const noexcept;
 
@@ -52,6 +94,9 @@ namespace M3DS {
         [[nodiscard]] const Root* getRoot() const noexcept;
         [[nodiscard]] bool isInTree() const noexcept;
 
+        // Safe to keep past the node's lifetime, resolving to null once it is destroyed.
+        [[nodiscard]] NodeHandle getHandle();
+
         [[nodiscard]] Viewport* getViewport() noexcept;
         [[nodiscard]] const Viewport* getViewport() const noexcept;
 
@@ -59,6 +104,7 @@ namespace M3DS {
 
         void setName(std::string_view name);
         [[nodiscard]] std::string_view getName() const noexcept;
+        [[nodiscard]] NodeName getNodeName() const noexcept;
 
         template <std::derived_from<Node> NodeType, bool isHelper = false, typename... Args>
         NodeType* emplaceChild(Args&&... args);
@@ -75,12 +121,33 @@ namespace M3DS {
 
         [[nodiscard]] bool isHelper() const noexcept;
 
+        void setProcessMode(ProcessMode mode);
+        [[nodiscard]] ProcessMode getProcessMode() const noexcept;
+        [[nodiscard]] bool isProcessing() const noexcept;
+
+        // Lower priorities update first.
+        void setProcessPriority(int priority);
+        [[nodiscard]] int getProcessPriority() const noexcept;
+
+        void setUpdateRate(UpdateRate rate);
+        [[nodiscard]] UpdateRate getUpdateRate() const noexcept;
+
+        // Frames between updates at UpdateRate::interval, 1 by default.
+        void setUpdateInterval(std::uint8_t frames);
+        [[nodiscard]] std::uint8_t getUpdateInterval() const noexcept;
+
         [[nodiscard]] BaseScript* getScript() noexcept;
         [[nodiscard]] const BaseScript* getScript() const noexcept;
 
         [[nodiscard]] Node* getNode(const NodePath& path) noexcept;
         [[nodiscard]] const Node* getNode(const NodePath& path) const noexcept;
 
+        [[nodiscard]] Node* getNode(const CompiledNodePath& path) noexcept;
+        [[nodiscard]] const Node* getNode(const CompiledNodePath& path) const noexcept;
+
+        // Bumped by every change to the shape or naming of any tree, invalidating cached path resolutions.
+        [[nodiscard]] static std::uint32_t getTreeGeneration() noexcept;
+
         [[nodiscard]] Node* getChild(std::size_t idx) noexcept;
         [[nodiscard]] const Node* getChild(std::size_t idx) const noexcept;
 
@@ -91,15 +158,50 @@ namespace M3DS {
 
         void printTree() const noexcept;
 
+        // Walks this subtree using the scratch space of the tree it is in.
+        template <TreeOrder Order, bool ReverseChildren = false>
+        [[nodiscard]] TreeWalk<Node, Order, ReverseChildren> walk();
+        template <TreeOrder Order, bool ReverseChildren = false>
+        [[nodiscard]] TreeWalk<const Node, Order, ReverseChildren> walk() const;
+
         template <bool PropagateDown = true>
         void propagateNotification(Notification notification) noexcept;
 
         void queueFree();
         void free();
+
+        // Groups are kept outside the tree, while Root only lists members in it.
+        void addToGroup(std::string_view group);
+        void removeFromGroup(std::string_view group);
+        [[nodiscard]] bool isInGroup(std::string_view group) const noexcept;
+
+        // Runs Method on this node when Root flushes its call queue, after the current frame's update.
+        // Outside the tree there is no frame to defer to, so the call runs immediately.
+        template <auto Method, typename Self, typename... Args>
+        requires std::is_invocable_v<decltype(Method), Self&, const Args&...>
+        void callDeferred(this Self& self, Args... args);
+
+        // Runs Method on this node once delay has passed on Root's timer wheel, dropped if the node is freed first.
+        // Counts down whether or not the node is processing. Outside the tree nothing is scheduled.
+        template <auto Method, typename Self, typename... Args>
+        requires std::is_invocable_v<decltype(Method), Self&, const Args&...>
+        TimerWheel::Id callAfter(this Self& self, Seconds<float> delay, Args... args);
+
+        // Runs coroutine on Root's scheduler until it finishes or this node leaves the tree. Outside the tree it is dropped.
+        CoroutineId startCoroutine(Coroutine coroutine);
+        void stopCoroutine(CoroutineId id) noexcept;
+
+        // Null outside the tree.
+        [[nodiscard]] TimerWheel* getTimerWheel() noexcept;
+        [[nodiscard]] const TimerWheel* getTimerWheel() const noexcept;
     protected:
         virtual void update(Seconds<float> delta);
         virtual void draw(RenderTarget2D& target);
         virtual void draw(RenderTarget3D& target);
+        // Pipelined counterpart of draw, copying what would be drawn into a snapshot.
+        virtual void record(RenderSnapshot& snapshot) const;
+        // False for nodes whose drawing record() cannot capture. Must not change while the node is in a tree.
+        [[nodiscard]] virtual bool isRecordable() const noexcept;
         virtual void input(Input::InputFrame& inputFrame);
 
         virtual void notification(Notification notification);
@@ -107,19 +209,112 @@ namespace M3DS {
         virtual void afterTreeEnter();
         virtual void beforeTreeExit();
     private:
-        bool mHelper {};
+        enum class ProcessState : std::uint8_t {
+            active,
+            paused,
+            disabled
+        };
 
-        std::string mName {};
+        // Position in Root's update buckets, owned by Root.
+        static constexpr std::uint32_t noUpdateSlot = std::numeric_limits<std::uint32_t>::max();
 
+        // Hot: read by per-frame passes and traversals, so kept together at the front of the node.
         Node* mParent {};
         Root* mRoot {};
+        std::vector<std::unique_ptr<Node>> mChildren {};
+        std::unique_ptr<BaseScript> mScript {};
         Viewport* mViewport {};
         const CanvasLayer* mCanvasLayer {};
-        std::vector<std::unique_ptr<Node>> mChildren {};
-
-        std::vector<std::pair<BaseSignal*, const MutableGenericMethod*>> mIncomingConnections {};
 
-        std::unique_ptr<BaseScript> mScript {};
+        std::uint32_t mUpdateSlot = noUpdateSlot;
+        std::uint16_t mUpdateBucket {};
+        // Resolved when entering the tree or when a process mode changes, never per frame.
+        ProcessState mProcessState = ProcessState::active;
+
+        bool mHelper : 1 {};
+        // Set on nodes in Root's free queue while they are detached from their parents.
+        bool mFreeing : 1 {};
+        bool mScriptHandlesInput : 1 {};
+        bool mScriptDraws : 1 {};
+        // Set when the node was created as exactly the class getClass() names, so Root may update it through
+        // that class's batch. Nodes of subclasses without their own M_CLASS, or created elsewhere, update virtually.
+        bool mExactClass : 1 {};
+        // Whether Root delivers input to this node, set by Root while it is in the tree.
+        bool mInputListener : 1 {};
+        // Set while the node waits to be merged into Root's input listeners, mInputSlot indexing the pending ones.
+        bool mInputPending : 1 {};
+
+        // Cold: only touched by name lookups and tree changes.
+        NodeName mName {};
+        // Stamp of the last change to the shape or naming of this node's subtree, taken from mTreeGeneration so
+        // a node never shares one with a node it replaced at the same address.
+        std::uint32_t mSubtreeGeneration = ++mTreeGeneration;
+
+        // Position in Root's list of live instances of this class.
+        std::uint16_t mInstanceList {};
+        std::uint32_t mInstanceSlot {};
+        std::uint32_t mInputSlot {};
+
+        // Coroutines started on this node, so nodes without any skip cancelling them on exit.
+        std::uint32_t mCoroutines {};
+        std::uint32_t mHandleIndex = NodeHandle::noIndex;
+
+        // Name lookup for nodes with many children, mapping a name to its first child and the number of children sharing it.
+        struct ChildIndexEntry {
+            Node* first {};
+            std::size_t count {};
+        };
+
+        static constexpr std::size_t childIndexThreshold = 8;
+        std::unique_ptr<std::unordered_map<NodeName, ChildIndexEntry>> mChildIndex {};
+
+        struct GroupMembership {
+            NodeName group {};
+            // Position in Root's list of the group, while in the tree.
+            std::uint32_t slot {};
+        };
+
+        // Settings most nodes leave at their defaults, allocated the first time one is changed.
+        struct ColdData {
+            std::vector<GroupMembership> groups {};
+            int processPriority {};
+            ProcessMode processMode = ProcessMode::inherit;
+            UpdateRate updateRate = UpdateRate::interval;
+            std::uint8_t updateInterval = 1;
+        };
+        std::unique_ptr<ColdData> mCold {};
+
+        [[nodiscard]] ColdData& getCold();
+        [[nodiscard]] std::span<GroupMembership> getGroups() noexcept;
+
+        static inline std::uint32_t mTreeGeneration {};
+
+        // Shared by walks of subtrees outside any Root.
+        static inline TreeScratch mDetachedScratch {};
+        [[nodiscard]] TreeScratch& getWalkScratch() const noexcept;
+
+        // Restamps this node and its ancestors, invalidating cached path resolutions that pass through them.
+        void touchSubtree() noexcept;
+        void linkChild(Node* child);
+        // Indexes a child as if it were the last, as appended children are.
+        void indexChild(Node* child);
+        void unindexChild(const Node* child, NodeName name);
+        void refreshChildIndexEntry(NodeName name);
+        [[nodiscard]] Node* findChild(NodeName name) const noexcept;
+        // Moves every child marked mFreeing into detached, keeping the order of the rest.
+        void detachFreeingChildren(std::vector<std::unique_ptr<Node>>& detached);
+
+        // Registration with everything Root tracks about nodes in its tree.
+        void joinRoot();
+        void leaveRoot() noexcept;
+
+        [[nodiscard]] CallQueue* getCallQueue() noexcept;
+        [[nodiscard]] bool handlesInput() const noexcept;
+
+        void refreshProcessState();
+        // Moves the node into the update bucket matching its priority and rate.
+        void refreshUpdateBucket();
+        [[nodiscard]] static ProcessState resolveProcessState(ProcessMode mode, ProcessState parentState) noexcept;
     };
 
     template <std::derived_from<Node> NodeType, bool isHelper, typename... Args>
@@ -129,11 +324,11 @@ namespace M3DS {
             Debug::err("Failed to allocate Node!");
             return {};
         }
+        childUPtr->mExactClass = std::same_as<typename NodeType::SelfType, NodeType>;
 
         auto child = static_cast<NodeType*>(mChildren.emplace_back(std::move(childUPtr)).get());
-        child->mParent = this;
-        child->mName = NodeType::getClassStatic();
         child->mHelper = isHelper;
+        linkChild(child);
         if (isInTree())
             static_cast<Node*>(child)->notification(Notification::tree_entered);
         return child;
@@ -153,10 +348,10 @@ namespace M3DS {
             Debug::err("Failed to allocate Node!");
             return {};
         }
+        childUPtr->mExactClass = std::same_as<typename NodeType::SelfType, NodeType>;
 
         auto child = static_cast<NodeType*>(mChildren.emplace_back(std::move(childUPtr)).get());
-        child->mParent = this;
-        child->mName = NodeType::getClassStatic();
+        linkChild(child);
 
         auto script = M3DS::make_unique_nothrow<ScriptType>();
         if (!script) {
@@ -165,6 +360,8 @@ namespace M3DS {
         }
         script->mNode = child;
         child->mScript = std::move(script);
+        child->mScriptHandlesInput = !std::same_as<decltype(&ScriptType::input), decltype(&BaseScript::input)>;
+        child->mScriptDraws = overridesDraw<ScriptType>;
         child->mScript->ready();
 
         if (isInTree())
@@ -172,21 +369,38 @@ namespace M3DS {
         return static_cast<ScriptType*>(child->mScript.get());
     }
 
-    template <bool PropagateDown>
-    void Node::propagateNotification(const Notification notification) noexcept {
-        if constexpr (PropagateDown) {
-            std::queue<Node*> queue {};
-            queue.emplace(this);
+    template <auto Method, typename Self, typename... Args>
+    requires std::is_invocable_v<decltype(Method), Self&, const Args&...>
+    void Node::callDeferred(this Self& self, Args... args) {
+        if (CallQueue* queue = static_cast<Node&>(self).getCallQueue())
+            queue->push(static_cast<Node&>(self).getHandle(), &CallQueue::invoke<Self, Method, Args...>, args...);
+        else
+            (self.*Method)(args...);
+    }
+
+    template <auto Method, typename Self, typename... Args>
+    requires std::is_invocable_v<decltype(Method), Self&, const Args&...>
+    TimerWheel::Id Node::callAfter(this Self& self, const Seconds<float> delay, Args... args) {
+        if (TimerWheel* wheel = static_cast<Node&>(self).getTimerWheel())
+            return wheel->schedule(delay, self, &CallQueue::invoke<Self, Method, Args...>, args...);
+        return {};
+    }
 
-            while (!queue.empty()) {
-                Node* curr = queue.front();
-                queue.pop();
+    template <TreeOrder Order, bool ReverseChildren>
+    TreeWalk<Node, Order, ReverseChildren> Node::walk() {
+        return { this, getWalkScratch() };
+    }
 
-                curr->notification(notification);
+    template <TreeOrder Order, bool ReverseChildren>
+    TreeWalk<const Node, Order, ReverseChildren> Node::walk() const {
+        return { this, getWalkScratch() };
+    }
 
-                for (const auto& child : curr->getChildren())
-                    queue.emplace(child.get());
-            }
+    template <bool PropagateDown>
+    void Node::propagateNotification(const Notification notification) noexcept {
+        if constexpr (PropagateDown) {
+            for (Node& curr : walk<TreeOrder::breadth_first>())
+                curr.notification(notification);
         } else {
             Node* curr = this;
             while (curr != nullptr) {
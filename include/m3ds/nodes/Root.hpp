@@ -2,10 +2,20 @@
 
 #include <m3ds/nodes/Node.hpp>
 
+#include <m3ds/utils/CallQueue.hpp>
 #include <m3ds/utils/Frame.hpp>
 #include <m3ds/utils/FrameTimer.hpp>
+#include <m3ds/utils/TimerWheel.hpp>
+#include <m3ds/utils/TweenSystem.hpp>
+#include <m3ds/utils/WorkerPool.hpp>
+#include <m3ds/render/GpuLock.hpp>
+#include <m3ds/render/RenderSnapshot.hpp>
+#include <m3ds/spatial/TransformHierarchy.hpp>
+#include <m3ds/utils/binding/Registry.hpp>
 
 namespace M3DS {
+    class MeshInstance;
+
     enum class Draw : std::uint8_t {
         none = 0,
         draw_2d = 1,
@@ -26,6 +36,7 @@ namespace M3DS {
         M_CLASS(Root, Node)
     public:
         Root() noexcept;
+        ~Root() noexcept override;
 
         void treeUpdate(Seconds<float> delta) noexcept;
         void treeDraw(Draw draw = Draw::draw_all) noexcept;
@@ -38,30 +49,234 @@ namespace M3DS {
     public:
         void exit() noexcept;
 
+        // Frees every node queued with queueFree. mainLoop does so after each frame, so loops
+        // calling treeUpdate themselves should too.
+        void flushFreeQueue();
+
         void mainLoop() noexcept;
         void mainLoop(MainLoopCallable auto callable) noexcept;
 
+        // When pipelined, the main loop callable runs on a worker while the previous frame is drawn
+        // from a snapshot, and treeDraw() only selects what the next snapshot draws. Frames are only
+        // pipelined while every node in the tree is recordable, and are drawn directly otherwise.
+        void setPipelined(bool pipelined) noexcept;
+        [[nodiscard]] bool isPipelined() const noexcept;
+
+        // Budgeted nodes of each class and priority updated per frame, at least 1.
+        void setUpdateBudget(std::uint32_t nodes) noexcept;
+        [[nodiscard]] std::uint32_t getUpdateBudget() const noexcept;
+
+        // Update intervals for nodes at Node::UpdateRate::distance, by increasing distance to the camera.
+        // Nodes use the first level they are within, or the last one beyond them all.
+        struct UpdateLod {
+            float distance {};
+            std::uint8_t interval = 1;
+        };
+
+        void setUpdateLods(std::vector<UpdateLod> lods);
+        [[nodiscard]] std::span<const UpdateLod> getUpdateLods() const noexcept;
+
         void enableUpdate(Node* node);
         void disableUpdate(Node* node);
+        void disableUpdateSubtree(Node* node);
 
         void addToFreeQueue(Node* node);
+
+        void addInputListener(Node* node);
+        void removeInputListener(Node* node);
+
+        [[nodiscard]] std::span<Node* const> getNodesInGroup(std::string_view group) const noexcept;
+
+        // Calls func on every member of group that is a T. Members may leave the group from func.
+        template <std::derived_from<Node> T = Node, typename Func>
+        requires std::is_invocable_v<Func&, T&>
+        void forEachInGroup(std::string_view group, Func&& func);
+
+        // Calls func on every T in the tree, including instances of classes deriving from T.
+        template <std::derived_from<Node> T, typename Func>
+        requires std::is_invocable_v<Func&, T&>
+        void forEachInstance(Func&& func);
+
+        // Flushed by mainLoop after each frame, before queued frees.
+        [[nodiscard]] CallQueue& getCallQueue() noexcept;
+
+        // Advanced at the start of treeUpdate.
+        [[nodiscard]] TimerWheel& getTimerWheel() noexcept;
+        [[nodiscard]] const TimerWheel& getTimerWheel() const noexcept;
+
+        // Advanced by treeUpdate, after nodes update.
+        [[nodiscard]] TweenSystem& getTweenSystem() noexcept;
+        [[nodiscard]] const TweenSystem& getTweenSystem() const noexcept;
+
+        // Coroutines waiting for the next frame are resumed by treeUpdate, after nodes update.
+        [[nodiscard]] CoroutineScheduler& getCoroutineScheduler() noexcept;
     protected:
         friend class Viewport;
 
         void addViewport(Viewport* viewport);
         void removeViewport(Viewport* viewport);
+
+        friend class MeshInstance;
+
+        void addMeshInstance(MeshInstance* meshInstance);
+        void removeMeshInstance(MeshInstance* meshInstance);
+
+        friend class Node;
+
+        // Shared by every walk of this tree.
+        TreeScratch mWalkScratch {};
+
+        void joinGroup(Node* node, Node::GroupMembership& membership);
+        void leaveGroup(const Node* node, const Node::GroupMembership& membership) noexcept;
+
+        void addInstance(Node* node);
+        void removeInstance(const Node* node) noexcept;
+
+        friend class Node3D;
+        friend class CanvasItem;
+
+        // Global transforms of every Node3D and CanvasItem in the tree, updated in one pass per frame.
+        TransformHierarchy3D mTransforms3D {};
+        TransformHierarchy2D mTransforms2D {};
     private:
         FrameTimer frameTimer {};
         bool mExit {};
 
         std::vector<Viewport*> mViewports {};
-        std::vector<Node*> mUpdateList {};
+        // Nodes are updated one class at a time, ordered by process priority. Disabled nodes leave a null
+        // tombstone, compacted away once per frame, and nodes enabled mid-update wait in mPendingUpdates.
+        // Nodes updating every n frames are split over n buckets, one running each frame, so the cost of
+        // a class stays level from frame to frame.
+        struct UpdateBucket {
+            Registry::UpdateBatch batch {};
+            int priority {};
+            std::vector<Node*> nodes {};
+            std::size_t tombstones {};
+
+            Node::UpdateRate rate = Node::UpdateRate::interval;
+            std::uint8_t interval = 1;
+            std::uint8_t phase {};
+            // Time since the bucket last ran.
+            Seconds<float> elapsed {};
+
+            // Budgeted buckets only: the next slot to update, and the update clock when each slot last updated.
+            std::uint32_t cursor {};
+            std::vector<Seconds<double>> lastUpdates {};
+        };
+
+        using UpdateBucketKey = std::tuple<int, Node::UpdateRate, std::uint8_t, std::string_view>;
+
+        static constexpr std::uint16_t pendingUpdateBucket = std::numeric_limits<std::uint16_t>::max();
+
+        std::vector<UpdateBucket> mUpdateBuckets {};
+        std::vector<std::uint16_t> mUpdateOrder {};
+        // Maps to the first of a bucket's phases, which follow it.
+        std::flat_map<UpdateBucketKey, std::uint16_t> mUpdateBucketLookup {};
+        std::vector<Node*> mPendingUpdates {};
+        bool mUpdating {};
 
-        std::queue<Node*> mFreeQueue {};
+        std::uint32_t mUpdateFrame {};
+        // Total time passed to treeUpdate, kept in double so budgeted nodes get precise deltas however long the game runs.
+        Seconds<double> mUpdateClock {};
+        std::uint32_t mUpdateBudget = 32;
+        std::vector<UpdateLod> mUpdateLods {};
+
+        // Nodes handling input in tree order, which treeInput delivers to back to front. Removed listeners are nulled
+        // and new ones wait in mPendingInputListeners, until both are merged in before input is next delivered.
+        std::vector<Node*> mInputListeners {};
+        std::vector<Node*> mPendingInputListeners {};
+        std::vector<Node*> mMergedInputListeners {};
+        std::uint32_t mInputListenerHoles {};
+
+        std::unordered_map<NodeName, std::vector<Node*>> mGroups {};
+
+        // Live nodes by exact class, created the first time a class enters the tree.
+        struct ClassInstances {
+            const TypeInfo* type {};
+            std::vector<Node*> nodes {};
+        };
+        std::vector<ClassInstances> mClassInstances {};
+        std::unordered_map<std::size_t, std::uint16_t> mClassInstanceLookup {};
+
+        // Iterated backwards, so a node removing itself only moves an already visited node into its slot.
+        template <typename T, typename Func>
+        static void forEachNode(const std::vector<Node*>& nodes, Func& func);
+
+        WorkerPool mWorkerPool {};
+        std::vector<MeshInstance*> mMeshInstances {};
+        std::vector<MeshInstance*> mAnimationQueue {};
+
+        CallQueue mCallQueue {};
+        TimerWheel mTimerWheel {};
+        TweenSystem mTweenSystem {};
+        CoroutineScheduler mCoroutineScheduler {};
+        // Freed together at the end of each frame, with scratch buffers kept between frames.
+        std::vector<Node*> mFreeQueue {};
+        std::vector<std::unique_ptr<Node>> mFreedSubtrees {};
 
         float mProcessLead {};
+
+        bool mPipelined {};
+        // Whether the current frame is pipelined, decided when it starts.
+        bool mFramePipelined {};
+        // Nodes in the tree that are not recordable, counted by Node.
+        std::uint32_t mUnrecordableNodes {};
+        Draw mDrawRequest = Draw::none;
+        Draw mSnapshotDraw = Draw::none;
+        RenderSnapshot mSnapshot {};
+
+        void animationUpdate(Seconds<float> delta) noexcept;
+        void compactUpdateBuckets() noexcept;
+        void insertUpdate(Node* node);
+        std::uint16_t getUpdateBucket(const UpdateBucketKey& key);
+        void budgetedUpdate(UpdateBucket& bucket);
+        // Whether node's update rate lets it update this frame, for work Root does on its behalf
+        // outside the update buckets.
+        [[nodiscard]] bool isUpdateDue(const Node& node) const noexcept;
+        // Moves nodes at UpdateRate::distance whose distance now calls for another interval.
+        void refreshUpdateLods(const UpdateBucket& bucket);
+        [[nodiscard]] std::uint8_t getLodInterval(const Node* node) const noexcept;
+
+        static void virtualUpdateBatch(std::span<Node* const> nodes, Seconds<float> delta);
+
+        void recordSnapshot();
+        void drawSnapshot() noexcept;
+
+        void refreshInputListeners();
+        // Whether lhs comes before rhs in a preorder walk of the tree both are in.
+        [[nodiscard]] static bool precedesInTree(const Node* lhs, const Node* rhs) noexcept;
     };
 
+    template <typename T, typename Func>
+    void Root::forEachNode(const std::vector<Node*>& nodes, Func& func) {
+        for (std::size_t i = nodes.size(); i-- > 0;) {
+            if (i >= nodes.size())
+                continue;
+            if (T* node = object_cast<T*>(nodes[i]))
+                std::invoke(func, *node);
+        }
+    }
+
+    template <std::derived_from<Node> T, typename Func>
+    requires std::is_invocable_v<Func&, T&>
+    void Root::forEachInGroup(const std::string_view group, Func&& func) {
+        const NodeName name = NodeName::find(group);
+        if (!name)
+            return;
+
+        if (const auto it = mGroups.find(name); it != mGroups.end())
+            forEachNode<T>(it->second, func);
+    }
+
+    template <std::derived_from<Node> T, typename Func>
+    requires std::is_invocable_v<Func&, T&>
+    void Root::forEachInstance(Func&& func) {
+        for (const ClassInstances& instances : mClassInstances) {
+            if (instances.type->derivesFrom(typeInfo<T>))
+                forEachNode<T>(instances.nodes, func);
+        }
+    }
+
     void Root::mainLoop(MainLoopCallable auto callable) noexcept {
         while (!mExit) {
             const Frame _ {};
@@ -69,15 +284,33 @@ namespace M3DS {
             if (aptShouldClose())
                 break;
 #endif
-            {
+            mFramePipelined = mPipelined && mUnrecordableNodes == 0;
+
+            if (mFramePipelined) {
+                const Seconds<float> delta = frameTimer();
+
+                // The tree may only be read while the worker is idle.
+                recordSnapshot();
+
+                auto simulate = [&] {
+                    std::invoke(callable, delta);
+                };
+                mWorkerPool.launch(simulate);
+
+                {
+                    const GpuLock gpuLock {};
+                    DrawEnvironment _ {};
+
+                    drawSnapshot();
+                }
+                mWorkerPool.wait();
+            } else {
                 DrawEnvironment _ {};
 
                 std::invoke(callable, frameTimer());
             }
-            while (!mFreeQueue.empty()) {
-                mFreeQueue.front()->free();
-                mFreeQueue.pop();
-            }
+            mCallQueue.flush();
+            flushFreeQueue();
         }
     }
 }
@@ -2,11 +2,14 @@
 
 #include <m3ds/nodes/Node.hpp>
 #include <m3ds/types/Signal.hpp>
+#include <m3ds/utils/TimerWheel.hpp>
 
 namespace M3DS {
+    // Counts down on Root's timer wheel rather than updating every frame. Only runs while in the tree and processing.
     class Timer : public Node {
         M_CLASS(Timer, Node)
     public:
+        // Changes apply from the next start or timeout.
         Seconds<float> duration = 10.f;
         bool oneShot = true;
 
@@ -24,10 +27,16 @@ namespace M3DS {
         [[nodiscard]] Seconds<float> getElapsed() const noexcept;
         [[nodiscard]] Seconds<float> getTimeLeft() const noexcept;
     protected:
-        void update(Seconds<float> delta) override;
+        void notification(Notification notification) override;
     private:
         bool mActive {};
+        // Kept up to date only while the timer is not scheduled.
         Seconds<float> mElapsed {};
+
+        TimerWheel::Id mScheduled {};
+
+        void schedule() noexcept;
+        void unschedule() noexcept;
+        void expire();
     };
 }
-
@@ -0,0 +1,183 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+namespace M3DS {
+    class Node;
+
+    enum class TreeOrder : std::uint8_t {
+        preorder,
+        postorder,
+        breadth_first
+    };
+
+    // Pending nodes of every TreeWalk sharing it, kept between walks so traversal stops allocating once warmed up.
+    // Walks may nest, each only touching the entries above where it started.
+    struct TreeScratch {
+        struct Entry {
+            const Node* node {};
+            bool expanded {};
+        };
+
+        std::vector<Entry> entries {};
+    };
+
+    // Iterates a subtree without recursion, visiting children first to last unless ReverseChildren.
+    // A node's children are read when the walk moves past it, or in postorder when it reaches it.
+    template <typename NodeType, TreeOrder Order, bool ReverseChildren = false>
+    class TreeWalk {
+    public:
+        TreeWalk(NodeType* root, TreeScratch& scratch);
+        ~TreeWalk() noexcept;
+
+        TreeWalk(const TreeWalk&) = delete;
+        TreeWalk& operator=(const TreeWalk&) = delete;
+
+        TreeWalk(TreeWalk&&) = delete;
+        TreeWalk& operator=(TreeWalk&&) = delete;
+
+        class Iterator {
+            friend class TreeWalk;
+        public:
+            using difference_type = std::ptrdiff_t;
+            using value_type = NodeType;
+
+            [[nodiscard]] NodeType& operator*() const noexcept;
+            Iterator& operator++();
+            void operator++(int);
+
+            [[nodiscard]] bool operator==(std::default_sentinel_t) const noexcept;
+        private:
+            TreeWalk* mWalk {};
+        };
+
+        // A walk can only be iterated once.
+        [[nodiscard]] Iterator begin() noexcept;
+        [[nodiscard]] std::default_sentinel_t end() const noexcept;
+
+        // Leaves the descendants of the node being visited out of the walk.
+        void skipChildren() noexcept requires (Order != TreeOrder::postorder);
+    private:
+        TreeScratch& mScratch;
+        std::size_t mBase;
+        std::size_t mHead;
+
+        NodeType* mCurrent {};
+        bool mSkip {};
+
+        void next();
+        void advance();
+        void pushChildren(NodeType* node);
+    };
+}
+
+/* Implementation */
+namespace M3DS {
+    template <typename NodeType, TreeOrder Order, bool ReverseChildren>
+    TreeWalk<NodeType, Order, ReverseChildren>::TreeWalk(NodeType* root, TreeScratch& scratch) :
+        mScratch(scratch),
+        mBase(scratch.entries.size()),
+        mHead(mBase) {
+        mScratch.entries.emplace_back(root);
+        advance();
+    }
+
+    template <typename NodeType, TreeOrder Order, bool ReverseChildren>
+    TreeWalk<NodeType, Order, ReverseChildren>::~TreeWalk() noexcept {
+        mScratch.entries.resize(mBase);
+    }
+
+    template <typename NodeType, TreeOrder Order, bool ReverseChildren>
+    NodeType& TreeWalk<NodeType, Order, ReverseChildren>::Iterator::operator*() const noexcept {
+        return *mWalk->mCurrent;
+    }
+
+    template <typename NodeType, TreeOrder Order, bool ReverseChildren>
+    auto TreeWalk<NodeType, Order, ReverseChildren>::Iterator::operator++() -> Iterator& {
+        mWalk->next();
+        return *this;
+    }
+
+    template <typename NodeType, TreeOrder Order, bool ReverseChildren>
+    void TreeWalk<NodeType, Order, ReverseChildren>::Iterator::operator++(int) {
+        mWalk->next();
+    }
+
+    template <typename NodeType, TreeOrder Order, bool ReverseChildren>
+    bool TreeWalk<NodeType, Order, ReverseChildren>::Iterator::operator==(std::default_sentinel_t) const noexcept {
+        return !mWalk->mCurrent;
+    }
+
+    template <typename NodeType, TreeOrder Order, bool ReverseChildren>
+    auto TreeWalk<NodeType, Order, ReverseChildren>::begin() noexcept -> Iterator {
+        Iterator it {};
+        it.mWalk = this;
+        return it;
+    }
+
+    template <typename NodeType, TreeOrder Order, bool ReverseChildren>
+    std::default_sentinel_t TreeWalk<NodeType, Order, ReverseChildren>::end() const noexcept {
+        return std::default_sentinel;
+    }
+
+    template <typename NodeType, TreeOrder Order, bool ReverseChildren>
+    void TreeWalk<NodeType, Order, ReverseChildren>::skipChildren() noexcept requires (Order != TreeOrder::postorder) {
+        mSkip = true;
+    }
+
+    template <typename NodeType, TreeOrder Order, bool ReverseChildren>
+    void TreeWalk<NodeType, Order, ReverseChildren>::next() {
+        if constexpr (Order != TreeOrder::postorder) {
+            if (!std::exchange(mSkip, false))
+                pushChildren(mCurrent);
+        }
+        advance();
+    }
+
+    template <typename NodeType, TreeOrder Order, bool ReverseChildren>
+    void TreeWalk<NodeType, Order, ReverseChildren>::advance() {
+        auto& entries = mScratch.entries;
+        mCurrent = nullptr;
+
+        if constexpr (Order == TreeOrder::breadth_first) {
+            if (mHead < entries.size())
+                mCurrent = const_cast<NodeType*>(entries[mHead++].node);
+        } else if constexpr (Order == TreeOrder::preorder) {
+            if (entries.size() > mBase) {
+                mCurrent = const_cast<NodeType*>(entries.back().node);
+                entries.pop_back();
+            }
+        } else {
+            // Each node is visited the second time it reaches the top, once all its children are done.
+            while (entries.size() > mBase) {
+                TreeScratch::Entry& top = entries.back();
+                if (top.expanded) {
+                    mCurrent = const_cast<NodeType*>(top.node);
+                    entries.pop_back();
+                    return;
+                }
+                top.expanded = true;
+                pushChildren(const_cast<NodeType*>(top.node));
+            }
+        }
+    }
+
+    template <typename NodeType, TreeOrder Order, bool ReverseChildren>
+    void TreeWalk<NodeType, Order, ReverseChildren>::pushChildren(NodeType* node) {
+        auto& entries = mScratch.entries;
+
+        // Entries are taken from the back in depth first orders, so children go in opposite to visiting order.
+        if constexpr ((Order != TreeOrder::breadth_first) != ReverseChildren) {
+            for (const auto& child : node->mChildren | std::views::reverse)
+                entries.emplace_back(child.get());
+        } else {
+            for (const auto& child : node->mChildren)
+                entries.emplace_back(child.get());
+        }
+    }
+}
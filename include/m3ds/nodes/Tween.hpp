@@ -3,15 +3,19 @@
 #include <m3ds/nodes/Node.hpp>
 #include <m3ds/types/Signal.hpp>
 #include <m3ds/utils/Interpolate.hpp>
+#include <m3ds/utils/TweenSystem.hpp>
 
 namespace M3DS {
     // TODO: serialisation
 
+    // Builds a sequence on Root's tween system, run while this node is in the tree and processing.
     class Tween : public Node {
         M_CLASS(Tween, Node)
     public:
+        // Emitted once every tween added since the sequence started has finished.
         Signal tweenComplete {};
 
+        // Runs alongside the other tweens of the current step. Outside the tree, member is set to tweenTo straight away.
         template <typename O, typename T>
         void tween(
             O* object,
@@ -31,30 +35,20 @@ namespace M3DS {
         //     Easing easing = Easing::in_out
         // ) noexcept;
 
+        // Tweens added after this start once the current step has finished.
+        void chain() noexcept;
+
         [[nodiscard]] bool isActive() const noexcept;
         void stop() noexcept;
     protected:
-        void update(Seconds<float> delta) override;
+        void notification(Notification notification) override;
     private:
-        float mDuration {};
-        float mElapsed {};
-        bool mActive {};
-
-        InterpolationMethod mMethod {};
-        Easing mEasing {};
-
-        Object* mTweenObject {};
-
-        template <typename T>
-        struct TweenData {
-            const Member<T>* member {};
-            T from {};
-            T to {};
-        };
-
-        using TweenVariant = BindableTypes::transform<TweenData>::apply<std::variant>;
+        TweenSystem::Id mSequence {};
 
-        TweenVariant mTweenData { TweenData<bool>{} };
+        [[nodiscard]] TweenSystem* getTweenSystem() noexcept;
+        [[nodiscard]] const TweenSystem* getTweenSystem() const noexcept;
+        // Returns the running sequence, starting one if needed.
+        [[nodiscard]] TweenSystem::Id getSequence(TweenSystem& tweens) noexcept;
     };
 
     template <typename O, typename T>
@@ -66,16 +60,9 @@ namespace M3DS {
         const InterpolationMethod method,
         const Easing easing
     ) noexcept {
-        mTweenObject = object;
-
-        mTweenData = TweenData<T>{ member, member->get(object), tweenTo };
-
-        mDuration = duration;
-
-        mMethod = method;
-        mEasing = easing;
-
-        mElapsed = 0.f;
-        mActive = true;
+        if (TweenSystem* tweens = getTweenSystem())
+            tweens->add(getSequence(*tweens), object, member, tweenTo, duration, method, easing);
+        else
+            member->set(object, tweenTo);
     }
 }
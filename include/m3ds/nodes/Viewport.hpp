@@ -9,6 +9,7 @@
 #include <m3ds/lib/SPhys/SPhys.hpp>
 
 #include <m3ds/render/WorldEnvironment3D.hpp>
+#include <m3ds/render/RenderSnapshot.hpp>
 
 #ifdef M3DS_SFML
 #include <SFML/Window/VideoMode.hpp>
@@ -64,11 +65,16 @@ namespace M3DS {
         void beforeTreeExit() override;
 
         void physicsUpdate(Seconds<float> delta) noexcept;
+
+        void recordSnapshot(RenderSnapshot& snapshot);
+        void drawSnapshot2D(const RenderSnapshot::ViewportData& data) noexcept;
+        void drawSnapshot3D(const RenderSnapshot& snapshot, const RenderSnapshot::ViewportData& data) noexcept;
     private:
         RenderTarget mTarget;
         Camera2D* mCamera2D {};
         Camera3D* mCamera3D {};
 
+        // Only touched while drawing, which in pipelined mode reads lights from the snapshot instead.
         LightEnv mLightEnv {};
         std::array<const Light3D*, 8> mLights {};
 
@@ -76,6 +82,9 @@ namespace M3DS {
         SPhys::PhysicsServer2D<> mPhysicsServer2D {};
 
         WorldEnvironment3D mWorldEnv3D {};
+
+        template <typename DrawFunc>
+        void drawStereo(const Matrix4x4* camera, const WorldEnvironment3D& worldEnv, DrawFunc&& drawFunc) noexcept;
     };
 
     constexpr auto& Viewport::getPhysicsServer3d() noexcept {
@@ -56,6 +56,7 @@ namespace M3DS {
     protected:
         void update(Seconds<float> delta) override;
         void draw(RenderTarget2D& target) override;
+        [[nodiscard]] bool isRecordable() const noexcept override;
 
         void shrinkToFit(const Vector2& size) noexcept;
 
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <type_traits>
 
 #include <m3ds/utils/binding/BoundMember.hpp>
@@ -9,6 +11,20 @@
 #include <m3ds/utils/Serialiser.hpp>
 
 namespace M3DS {
+    class Registry;
+
+    // Compile-time identity of an M_CLASS, holding the IDs of every class it derives from, Object first,
+    // so whether an object derives from a class is a single comparison at that class's depth.
+    struct TypeInfo {
+        std::size_t id {};
+        std::size_t depth {};
+        const std::size_t* ancestors {};
+
+        [[nodiscard]] constexpr bool derivesFrom(const TypeInfo& base) const noexcept {
+            return depth >= base.depth && ancestors[base.depth] == base.id;
+        }
+    };
+
     class Object {
         friend class Registry;
         friend class ResourceRegistry;
@@ -21,8 +37,7 @@ namespace M3DS {
         [[nodiscard]] virtual std::string_view getParentClass() const noexcept;
         [[nodiscard]] virtual std::string_view getClass() const noexcept;
 
-        [[nodiscard]] static constexpr bool inheritsFromHash(std::size_t fromClass) noexcept;
-        [[nodiscard]] virtual bool inheritsFromHashVirtual(std::size_t fromClass) const noexcept;
+        [[nodiscard]] virtual const TypeInfo& getTypeInfo() const noexcept;
         [[nodiscard]] bool inherits(std::string_view typeName) const noexcept;
 
         [[nodiscard]] static BoundMethodPair getMethodStatic(std::string_view name) noexcept;
@@ -72,21 +87,47 @@ namespace M3DS {
         return "Object";
     }
 
-    constexpr bool Object::inheritsFromHash(const std::size_t fromClass) noexcept {
-        return fromClass == fnv1a_hash(getClassStatic());
-    }
+    template <ObjectType T>
+    inline constexpr std::size_t typeId = fnv1a_hash(T::getClassStatic());
+
+    template <ObjectType T>
+    inline constexpr auto typeAncestors = [] {
+        if constexpr (std::same_as<T, Object>) {
+            return std::array{ typeId<Object> };
+        } else {
+            using Parent = typename T::SuperType;
+
+            std::array<std::size_t, typeAncestors<Parent>.size() + 1> ancestors {};
+            std::ranges::copy(typeAncestors<Parent>, ancestors.begin());
+            ancestors.back() = typeId<T>;
+            return ancestors;
+        }
+    }();
+
+    template <ObjectType T>
+    inline constexpr TypeInfo typeInfo { typeId<T>, typeAncestors<T>.size() - 1, typeAncestors<T>.data() };
 
     template <ObjectTypePointer T, ObjectType U> requires (!std::is_const_v<U>)
     T object_cast(U* obj) noexcept {
-        if (!obj || !obj->inherits(std::remove_pointer_t<T>::getClassStatic())) return nullptr;
-        return reinterpret_cast<T>(obj);
+        using Target = std::remove_pointer_t<T>;
+        if constexpr (std::derived_from<U, Target>) {
+            return obj;
+        } else {
+            if (!obj || !obj->getTypeInfo().derivesFrom(typeInfo<Target>)) return nullptr;
+            return reinterpret_cast<T>(obj);
+        }
     }
 
     template <ObjectTypePointer T>
     requires (std::is_const_v<std::remove_pointer_t<T>>)
     T object_cast(const std::derived_from<Object> auto* obj) noexcept {
-        if (!obj || !obj->inherits(std::remove_pointer_t<T>::getClassStatic())) return nullptr;
-        return reinterpret_cast<T>(obj);
+        using Target = std::remove_const_t<std::remove_pointer_t<T>>;
+        if constexpr (std::derived_from<std::remove_cvref_t<decltype(*obj)>, Target>) {
+            return obj;
+        } else {
+            if (!obj || !obj->getTypeInfo().derivesFrom(typeInfo<Target>)) return nullptr;
+            return reinterpret_cast<T>(obj);
+        }
     }
 
     template <ObjectType T, ObjectType U>
@@ -107,6 +148,7 @@ namespace M3DS {
 }
 
 #define M_CLASS(m_class, m_inherits)                                                                            \
+friend class M3DS::Registry;                                                                                    \
 public:                                                                                                         \
 using SelfType = m_class;                                                                                       \
 using SuperType = m_inherits;                                                                                   \
@@ -122,12 +164,8 @@ using SuperType = m_inherits;
 [[nodiscard]] std::string_view getClass() const noexcept override {                                             \
     return getClassStatic();                                                                                    \
 }                                                                                                               \
-[[nodiscard]] static constexpr bool inheritsFromHash(const std::size_t fromClassHash) noexcept {                \
-    if (M3DS::fnv1a_hash(getClassStatic()) == fromClassHash) return true;                                       \
-    return SuperType::inheritsFromHash(fromClassHash);                                                          \
-}                                                                                                               \
-[[nodiscard]] bool inheritsFromHashVirtual(const std::size_t fromClassHash) const noexcept override {           \
-    return inheritsFromHash(fromClassHash);                                                                     \
+[[nodiscard]] const M3DS::TypeInfo& getTypeInfo() const noexcept override {                                    \
+    return M3DS::typeInfo<SelfType>;                                                                            \
 }                                                                                                               \
 static_assert(std::string_view{#m_class}.size() < std::numeric_limits<std::uint8_t>::max());                    \
 [[nodiscard]] static M3DS::BoundMethodPair getMethodStatic(const std::string_view name) noexcept;               \
@@ -147,14 +185,8 @@ private:
 #define REGISTER_METHODS(CLASS_NAME, ...)                                                                       \
 M3DS::BoundMethodPair CLASS_NAME::getMethodStatic(const std::string_view name) noexcept {                       \
     static constexpr M3DS::MethodPack methods { __VA_ARGS__ };                                                  \
-    for (const M3DS::BoundMethodPair& pair : methods.getMethods()) {                                            \
-        const auto& [constMethod, mutableMethod] = pair;                                                        \
-        if (                                                                                                    \
-            (constMethod && constMethod->getName() == name) ||                                                  \
-            (mutableMethod && mutableMethod->getName() == name)                                                 \
-        )                                                                                                       \
+    if (const M3DS::BoundMethodPair pair = methods.find(name); pair.constMethod || pair.mutableMethod)          \
         return pair;                                                                                            \
-    }                                                                                                           \
     return SuperType::getMethodStatic(name);                                                                    \
 }
 
@@ -181,8 +213,9 @@ M3DS::SingleMethod{
 #define REGISTER_MEMBERS(CLASS_NAME, ...)                                                                       \
 const M3DS::GenericMember* CLASS_NAME::getMemberStatic(const std::string_view name) noexcept {                  \
     static constexpr M3DS::ObjectPack members = M3DS::createObjectPack<M3DS::GenericMember>( __VA_ARGS__ );     \
-    for (const M3DS::GenericMember* member : members.getElements())                                             \
-        if (member->getName() == name)                                                                          \
-            return member;                                                                                      \
+    static constexpr auto elements = members.getElements();                                                     \
+    static constexpr M3DS::NameLookup lookup { M3DS::getNames(elements) };                                      \
+    if (const std::size_t idx = lookup.find(name); idx != lookup.npos)                                          \
+        return elements[idx];                                                                                   \
     return SuperType::getMemberStatic(name);                                                                    \
 }
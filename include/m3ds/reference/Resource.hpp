@@ -109,6 +109,7 @@ namespace M3DS {
             }
         }
 
+        des.retain(resource);
         return Success;
     }
 }
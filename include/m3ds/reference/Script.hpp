@@ -30,4 +30,16 @@ namespace M3DS {
     };
 
     template <typename T> concept script_type = std::derived_from<T, BaseScript>;
+
+    template <typename Target, typename C>
+    C* getDrawOwner(void (C::*)(const Target&));
+
+    template <typename ScriptType, typename Target>
+    concept declares_draw = requires {
+        requires !std::same_as<decltype(getDrawOwner<Target>(&ScriptType::draw)), BaseScript*>;
+    };
+
+    // Whether ScriptType, or a script it derives from, overrides either draw callback.
+    template <script_type ScriptType>
+    constexpr bool overridesDraw = declares_draw<ScriptType, RenderTarget2D> || declares_draw<ScriptType, RenderTarget3D>;
 }
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstddef>
+#include <expected>
+#include <vector>
+
+#include <m3ds/reference/Resource.hpp>
+#include <m3ds/nodes/Node.hpp>
+
+namespace M3DS {
+    // A node subtree held as serialised bytes in memory, so it can be instantiated repeatedly
+    // without touching the filesystem. Packing reads the bytes back once to record the class of every node
+    // and keep the resources they load, so instancing neither looks classes up nor reloads resources.
+    class PackedScene : public Resource {
+        M_CLASS(PackedScene, Resource)
+    public:
+        [[nodiscard]] PackedScene() noexcept = default;
+
+        // Serialises node and its non-helper children into the template.
+        [[nodiscard]] Failure pack(const Node& node) noexcept;
+        // Reads a scene written by Registry::serialise into the template, in one read.
+        [[nodiscard]] Failure pack(const std::filesystem::path& scenePath) noexcept;
+
+        [[nodiscard]] std::expected<std::unique_ptr<Node>, Failure> instantiate() const noexcept;
+        template <std::derived_from<Node> N>
+        [[nodiscard]] std::expected<std::unique_ptr<N>, Failure> instantiate() const noexcept;
+
+        [[nodiscard]] bool isEmpty() const noexcept;
+        [[nodiscard]] std::size_t getSize() const noexcept;
+
+        void clear() noexcept;
+    private:
+        std::vector<std::byte> mData {};
+        DeserialiseCache mCache {};
+
+        [[nodiscard]] Failure record() noexcept;
+    };
+
+    template <std::derived_from<Node> N>
+    std::expected<std::unique_ptr<N>, Failure> PackedScene::instantiate() const noexcept {
+        if (std::expected exp = instantiate()) {
+            if (std::unique_ptr node = object_pointer_cast<N>(std::move(exp.value())))
+                return node;
+            return std::unexpected{ Failure{ ErrorCode::object_cast_failed } };
+        } else {
+            return std::unexpected{ exp.error() };
+        }
+    }
+}
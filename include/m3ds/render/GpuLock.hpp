@@ -0,0 +1,16 @@
+#pragma once
+
+namespace M3DS {
+    // Held while creating or destroying GPU resources or linear memory, as neither citro3d nor the linear
+    // heap is thread safe and a pipelined simulation (see Root::setPipelined) runs on a worker. The main
+    // thread holds it for the whole of a pipelined draw, so loads from the simulation wait for the draw
+    // to finish. Recursive, so drawing code may allocate while holding it.
+    class GpuLock {
+    public:
+        GpuLock() noexcept;
+        ~GpuLock() noexcept;
+
+        GpuLock(const GpuLock&) = delete;
+        GpuLock& operator=(const GpuLock&) = delete;
+    };
+}
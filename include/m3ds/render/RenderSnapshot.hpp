@@ -0,0 +1,98 @@
+#pragma once
+
+#include <array>
+#include <optional>
+#include <vector>
+
+#include <m3ds/nodes/3d/MeshInstance.hpp>
+#include <m3ds/render/SpriteSheet.hpp>
+#include <m3ds/render/WorldEnvironment3D.hpp>
+#include <m3ds/spatial/Matrix4x4.hpp>
+#include <m3ds/spatial/Transform2D.hpp>
+
+namespace M3DS {
+    class Viewport;
+
+    // Copy of everything needed to draw a frame, taken at the frame boundary so the
+    // tree can be simulated on a worker while the previous frame is being drawn.
+    class RenderSnapshot {
+    public:
+        struct MeshCommand {
+            std::shared_ptr<const Mesh> mesh {};
+            Matrix4x4 transform = Matrix4x4::identity();
+            std::size_t firstBone {};
+            std::size_t boneCount {};
+        };
+
+        struct Sprite3DCommand {
+            SpriteSheet spriteSheet {};
+            Matrix4x4 transform = Matrix4x4::identity();
+            std::uint32_t frame {};
+            float pixelSize {};
+            bool cullBack {};
+            bool billboard {};
+        };
+
+        struct Sprite2DCommand {
+            SpriteSheet spriteSheet {};
+            Transform2D transform {};
+            std::uint32_t frame {};
+            bool centre {};
+            bool ignoreCamera {};
+        };
+
+        struct LightData {
+            Vector3 colour {};
+            Vector3 position {};
+        };
+
+        struct ViewportData {
+            Viewport* viewport {};
+
+            std::optional<Matrix4x4> camera3D {};
+            std::optional<Vector2> camera2D {};
+            std::array<std::optional<LightData>, 8> lights {};
+            WorldEnvironment3D worldEnvironment {};
+
+            std::vector<MeshCommand> meshes {};
+            std::vector<Sprite3DCommand> sprites3D {};
+            std::vector<Sprite2DCommand> sprites2D {};
+        };
+
+        // Keeps all allocations, so recording the same scene again does not touch the heap.
+        void clear() noexcept;
+
+        ViewportData& beginViewport(Viewport* viewport);
+
+        void addMesh(
+            const std::shared_ptr<const Mesh>& mesh,
+            const Matrix4x4& transform,
+            std::span<const MeshInstance::BoneInstance> bones
+        );
+        void addSprite(
+            const SpriteSheet& spriteSheet,
+            const Matrix4x4& transform,
+            std::uint32_t frame,
+            float pixelSize,
+            bool cullBack,
+            bool billboard
+        );
+        void addSprite(
+            const SpriteSheet& spriteSheet,
+            const Transform2D& transform,
+            std::uint32_t frame,
+            bool centre,
+            bool ignoreCamera
+        );
+
+        [[nodiscard]] std::span<const ViewportData> getViewports() const noexcept;
+        [[nodiscard]] std::span<const Matrix4x4> getBones(const MeshCommand& command) const noexcept;
+    private:
+        std::vector<ViewportData> mViewports {};
+        std::size_t mViewportCount {};
+
+        std::vector<Matrix4x4> mBones {};
+
+        ViewportData& current() noexcept;
+    };
+}
@@ -17,6 +17,7 @@
 #include <m3ds/render/WorldEnvironment3D.hpp>
 
 namespace M3DS {
+    class Mesh;
     class MeshInstance;
 
     enum class Screen : std::uint8_t {
@@ -138,6 +139,7 @@ namespace M3DS {
 
         void prepare(float iod) noexcept;
         void render(const MeshInstance& meshInstance) noexcept;
+        void render(const Mesh& mesh, const Matrix4x4& transform, std::span<const Matrix4x4> bones) noexcept;
 
         void drawSkybox() noexcept;
         void drawSprite(const SpriteSheet& spriteSheet, const Matrix4x4& transform, std::uint32_t frame, float pixelSize, bool cullBack = false, bool billboard = false) noexcept;
@@ -162,5 +164,8 @@ namespace M3DS {
         Matrix4x4 mProjection = Matrix4x4::identity();
 
         void bind(C3D_Tex* texture) noexcept;
+
+        template <typename BoneTransform>
+        void renderMesh(const Mesh& mesh, const Matrix4x4& transform, bool skinned, BoneTransform&& boneTransform) noexcept;
     };
 }
@@ -0,0 +1,180 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <m3ds/spatial/Matrix4x4.hpp>
+#include <m3ds/spatial/Transform2D.hpp>
+
+namespace M3DS {
+    // Local and global transforms of a node hierarchy in contiguous arrays, with every parent stored
+    // before its children. Changing a local transform only flags that entry, and global transforms are
+    // brought up to date by one linear pass, which recomputes an entry if it is flagged or its parent
+    // was recomputed after it. Entries are only appended, so removal leaves a hole until compact().
+    template <typename Transform, typename Compose>
+    class TransformHierarchy {
+    public:
+        using Index = std::uint32_t;
+        static constexpr Index noIndex = std::numeric_limits<Index>::max();
+
+        // parent must already be in the hierarchy. owner is rewritten whenever the entry moves.
+        Index add(Index parent, const Transform& local, Index* owner);
+        void remove(Index index) noexcept;
+
+        void setLocal(Index index, const Transform& local) noexcept;
+        // Only brings the entries up to index up to date, as nothing after it can affect it.
+        // The reference is invalidated by adding entries or compacting.
+        [[nodiscard]] const Transform& getGlobal(Index index) const noexcept;
+
+        // Recomputes every out of date global transform, then compacts if over half the entries are holes.
+        void update() noexcept;
+        void compact() noexcept;
+
+        [[nodiscard]] std::size_t size() const noexcept;
+    private:
+        std::vector<Transform> mLocal {};
+        mutable std::vector<Transform> mGlobal {};
+        std::vector<Index> mParent {};
+        std::vector<Index*> mOwner {};
+        mutable std::vector<std::uint8_t> mDirty {};
+        // When each global transform was last recomputed, compared against the parent's.
+        mutable std::vector<std::uint64_t> mStamp {};
+        mutable std::uint64_t mClock {};
+
+        // Every entry before this one is up to date.
+        mutable std::size_t mFirstDirty {};
+        std::size_t mHoles {};
+
+        void flush(std::size_t end) const noexcept;
+    };
+
+    struct ComposeMatrix {
+        [[nodiscard]] constexpr Matrix4x4 operator()(const Matrix4x4& parent, const Matrix4x4& local) const noexcept {
+            return parent * local;
+        }
+    };
+
+    struct ComposeTransform2D {
+        [[nodiscard]] constexpr Transform2D operator()(const Transform2D& parent, const Transform2D& local) const noexcept {
+            return parent.offset(local);
+        }
+    };
+
+    using TransformHierarchy3D = TransformHierarchy<Matrix4x4, ComposeMatrix>;
+    using TransformHierarchy2D = TransformHierarchy<Transform2D, ComposeTransform2D>;
+}
+
+/* Implementation */
+namespace M3DS {
+    template <typename Transform, typename Compose>
+    auto TransformHierarchy<Transform, Compose>::add(const Index parent, const Transform& local, Index* owner) -> Index {
+        const auto index = static_cast<Index>(mLocal.size());
+
+        mLocal.emplace_back(local);
+        mGlobal.emplace_back(local);
+        mParent.emplace_back(parent);
+        mOwner.emplace_back(owner);
+        mDirty.emplace_back(true);
+        mStamp.emplace_back();
+
+        mFirstDirty = std::min<std::size_t>(mFirstDirty, index);
+        return *owner = index;
+    }
+
+    template <typename Transform, typename Compose>
+    void TransformHierarchy<Transform, Compose>::remove(const Index index) noexcept {
+        if (index >= mOwner.size() || !mOwner[index])
+            return;
+
+        *mOwner[index] = noIndex;
+        mOwner[index] = nullptr;
+        ++mHoles;
+    }
+
+    template <typename Transform, typename Compose>
+    void TransformHierarchy<Transform, Compose>::setLocal(const Index index, const Transform& local) noexcept {
+        mLocal[index] = local;
+        mDirty[index] = true;
+        mFirstDirty = std::min<std::size_t>(mFirstDirty, index);
+    }
+
+    template <typename Transform, typename Compose>
+    const Transform& TransformHierarchy<Transform, Compose>::getGlobal(const Index index) const noexcept {
+        if (index >= mFirstDirty)
+            flush(index + 1);
+        return mGlobal[index];
+    }
+
+    template <typename Transform, typename Compose>
+    void TransformHierarchy<Transform, Compose>::update() noexcept {
+        flush(mLocal.size());
+
+        if (mHoles > mLocal.size() / 2)
+            compact();
+    }
+
+    template <typename Transform, typename Compose>
+    void TransformHierarchy<Transform, Compose>::flush(const std::size_t end) const noexcept {
+        for (std::size_t i = mFirstDirty; i < end; ++i) {
+            if (!mOwner[i])
+                continue;
+
+            const Index parent = mParent[i];
+            if (parent == noIndex) {
+                if (mDirty[i]) {
+                    mGlobal[i] = mLocal[i];
+                    mStamp[i] = ++mClock;
+                }
+            } else if (mDirty[i] || mStamp[parent] > mStamp[i]) {
+                mGlobal[i] = Compose{}(mGlobal[parent], mLocal[i]);
+                mStamp[i] = ++mClock;
+            }
+            mDirty[i] = false;
+        }
+
+        mFirstDirty = std::max(mFirstDirty, end);
+    }
+
+    template <typename Transform, typename Compose>
+    void TransformHierarchy<Transform, Compose>::compact() noexcept {
+        std::vector<Index> remap(mLocal.size(), noIndex);
+        Index next {};
+        std::size_t upToDate {};
+
+        // Moving entries down in order keeps every parent before its children.
+        for (std::size_t i{}; i < mLocal.size(); ++i) {
+            if (!mOwner[i])
+                continue;
+
+            remap[i] = next;
+            mLocal[next] = mLocal[i];
+            mGlobal[next] = mGlobal[i];
+            mParent[next] = mParent[i] == noIndex ? noIndex : remap[mParent[i]];
+            mOwner[next] = mOwner[i];
+            mDirty[next] = mDirty[i];
+            mStamp[next] = mStamp[i];
+            *mOwner[next] = next;
+
+            if (i < mFirstDirty)
+                ++upToDate;
+            ++next;
+        }
+
+        mLocal.resize(next);
+        mGlobal.resize(next);
+        mParent.resize(next);
+        mOwner.resize(next);
+        mDirty.resize(next);
+        mStamp.resize(next);
+
+        mHoles = 0;
+        mFirstDirty = upToDate;
+    }
+
+    template <typename Transform, typename Compose>
+    std::size_t TransformHierarchy<Transform, Compose>::size() const noexcept {
+        return mLocal.size() - mHoles;
+    }
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <m3ds/types/NodeName.hpp>
+#include <m3ds/types/NodePath.hpp>
+
+namespace M3DS {
+    class Node;
+
+    // NodePath split once into interned names, for paths that are resolved repeatedly.
+    // When cached, the last resolution is reused until the subtree the path walks through changes. The cache
+    // belongs to this copy, so each owner resolving the same path should keep its own.
+    class CompiledNodePath {
+        friend class Node;
+    public:
+        CompiledNodePath() noexcept = default;
+        explicit CompiledNodePath(const NodePath& path, bool cached = true);
+
+        // Leading ".." segments.
+        [[nodiscard]] std::size_t getParentHops() const noexcept;
+        // Remaining segments, where an empty name stands for "..".
+        [[nodiscard]] std::span<const NodeName> getSegments() const noexcept;
+
+        [[nodiscard]] bool isCached() const noexcept;
+    private:
+        std::vector<NodeName> mSegments {};
+        std::size_t mParentHops {};
+        // Further hops above the first segment that later ".." segments reach, locating the node whose subtree holds the whole walk.
+        std::size_t mAnchorHops {};
+        // Set by segments that can never match a node, such as the empty one in "a//b".
+        bool mUnresolvable {};
+        bool mCached {};
+
+        struct Cache {
+            const Node* from {};
+            const Node* anchor {};
+            const Node* node {};
+            std::uint32_t generation {};
+            bool valid {};
+        };
+        mutable Cache mCache {};
+    };
+}
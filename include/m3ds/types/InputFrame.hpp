@@ -21,6 +21,10 @@ namespace M3DS::Input {
         [[nodiscard]] constexpr std::optional<Vector2> getCursor() const noexcept;
         constexpr std::optional<Vector2> consumeCursor() noexcept;
 
+        // Stops the frame reaching any further nodes.
+        constexpr void setHandled() noexcept;
+        [[nodiscard]] constexpr bool isHandled() const noexcept;
+
         explicit constexpr operator bool() const noexcept;
     private:
         ControllerState mState {};
@@ -28,6 +32,7 @@ namespace M3DS::Input {
 
         std::uint32_t consumedInputs {};
         bool cursorConsumed {};
+        bool handled {};
     };
 
     constexpr InputFrame::InputFrame(const std::uint32_t controller) noexcept
@@ -79,6 +84,14 @@ namespace M3DS::Input {
         return mState.cursor;
     }
 
+    constexpr void InputFrame::setHandled() noexcept {
+        handled = true;
+    }
+
+    constexpr bool InputFrame::isHandled() const noexcept {
+        return handled;
+    }
+
     constexpr InputFrame::operator bool() const noexcept {
         return static_cast<bool>(mState);
     }
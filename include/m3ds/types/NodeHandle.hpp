@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace M3DS {
+    class Node;
+
+    // Weak reference to a node, resolving to null once the node is destroyed.
+    // An index into a central slot table plus the generation of the slot when the handle was made,
+    // so resolving is one bounds check and one compare. Nodes only take a slot once asked for a handle.
+    class NodeHandle {
+    public:
+        constexpr NodeHandle() noexcept = default;
+
+        [[nodiscard]] Node* get() const noexcept;
+
+        [[nodiscard]] explicit operator bool() const noexcept;
+
+        constexpr bool operator==(const NodeHandle& other) const noexcept = default;
+    private:
+        friend class Node;
+
+        static constexpr std::uint32_t noIndex = std::numeric_limits<std::uint32_t>::max();
+
+        std::uint32_t mIndex = noIndex;
+        std::uint32_t mGeneration {};
+
+        constexpr NodeHandle(std::uint32_t index, std::uint32_t generation) noexcept;
+
+        struct Slot {
+            Node* node {};
+            std::uint32_t generation {};
+        };
+
+        static inline std::vector<Slot> mSlots {};
+        static inline std::vector<std::uint32_t> mFreeSlots {};
+
+        [[nodiscard]] static std::uint32_t acquire(Node* node);
+        [[nodiscard]] static NodeHandle fromIndex(std::uint32_t index) noexcept;
+        // Invalidates every handle to the slot.
+        static void release(std::uint32_t index) noexcept;
+    };
+
+    constexpr NodeHandle::NodeHandle(const std::uint32_t index, const std::uint32_t generation) noexcept
+        : mIndex(index), mGeneration(generation)
+    {}
+
+    inline Node* NodeHandle::get() const noexcept {
+        if (mIndex >= mSlots.size())
+            return {};
+
+        const Slot& slot = mSlots[mIndex];
+        return slot.generation == mGeneration ? slot.node : nullptr;
+    }
+
+    inline NodeHandle::operator bool() const noexcept {
+        return get() != nullptr;
+    }
+}
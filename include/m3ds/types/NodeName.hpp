@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+namespace M3DS {
+    // Interned node name. Equal names share an id, so comparisons are a single integer compare.
+    // Interned strings live for the rest of the program.
+    class NodeName {
+    public:
+        constexpr NodeName() noexcept = default;
+        explicit NodeName(std::string_view name);
+
+        // Looks a name up without interning it, returning an empty name if it was never interned.
+        [[nodiscard]] static NodeName find(std::string_view name) noexcept;
+
+        [[nodiscard]] std::string_view view() const noexcept;
+        [[nodiscard]] constexpr std::uint32_t getId() const noexcept;
+
+        [[nodiscard]] explicit constexpr operator bool() const noexcept;
+
+        constexpr bool operator==(const NodeName& other) const noexcept = default;
+    private:
+        std::uint32_t mId {};
+    };
+
+    constexpr std::uint32_t NodeName::getId() const noexcept {
+        return mId;
+    }
+
+    constexpr NodeName::operator bool() const noexcept {
+        return mId != 0;
+    }
+}
+
+template <>
+struct std::hash<M3DS::NodeName> {
+    size_t operator()(const M3DS::NodeName& name) const noexcept {
+        return name.getId();
+    }
+};
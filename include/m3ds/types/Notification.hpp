@@ -4,6 +4,9 @@ namespace M3DS {
     enum class Notification {
         tree_entered,
         tree_exited,
+        // Sent when a node in the tree stops or starts processing.
+        paused,
+        unpaused,
         exit
     };
 }
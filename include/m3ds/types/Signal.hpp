@@ -1,5 +1,7 @@
 #pragma once
 
+#include <algorithm>
+#include <utility>
 #include <vector>
 
 #include <m3ds/containers/HeapArray.hpp>
@@ -10,16 +12,13 @@
 #include <m3ds/utils/binding/Registry.hpp>
 
 namespace M3DS {
+    // Connections hold handles, so listeners may be destroyed without telling the signal.
+    // Connections to destroyed nodes are skipped when emitting and dropped on the next connect.
     class BaseSignal {
-        friend class Node;
     public:
-        ~BaseSignal() noexcept {
-            disconnectAll();
-        }
-
         void connect(Node& node, const MutableGenericMethod& method) {
-            mConnections.emplace_back(&node, &method);
-            node.mIncomingConnections.emplace_back(this, &method);
+            dropExpired();
+            mConnections.emplace_back(node.getHandle(), &method);
         }
 
         [[nodiscard]] Failure connect(Node& node, const std::string_view methodName) {
@@ -31,33 +30,110 @@ namespace M3DS {
         }
 
         void disconnect(Node& node, const MutableGenericMethod* method) {
-            std::erase_if(mConnections, [&](auto& pair) { return pair.first == &node && pair.second == method; });
-            std::erase_if(node.mIncomingConnections, [&](auto& pair) { return pair.first == this && pair.second == method; });
+            const NodeHandle handle = node.getHandle();
+            std::erase_if(mConnections, [&](auto& pair) { return pair.first == handle && pair.second == method; });
         }
 
         void disconnect(Node& node) {
-            std::erase_if(mConnections, [&](auto& pair) { return pair.first == &node; });
-            std::erase_if(node.mIncomingConnections, [&](auto& pair) { return pair.first == this; });
+            const NodeHandle handle = node.getHandle();
+            std::erase_if(mConnections, [&](auto& pair) { return pair.first == handle; });
+            std::erase_if(mDirectConnections, [&](auto& pair) { return pair.first == handle; });
+        }
+
+        // Resumes the coroutine once, on the next emit. Used by waitSignal.
+        void addWaiter(const NodeHandle owner, const CoroutineId id) {
+            dropExpired();
+            mWaiters.emplace_back(owner, id);
         }
 
-        void disconnectAll() {
-            for (Node* node : mConnections | std::views::keys)
-                std::erase_if(node->mIncomingConnections, [this](auto& pair) { return pair.first == this; });
+        void disconnectAll() noexcept {
             mConnections.clear();
+            mDirectConnections.clear();
         }
     protected:
-        std::vector<std::pair<Node*, const MutableGenericMethod*>> mConnections {};
+        // Stored type-erased so every signal shares one layout, AbstractSignal casts them back.
+        using ErasedThunk = void (*)();
+
+        std::vector<std::pair<NodeHandle, const MutableGenericMethod*>> mConnections {};
+        std::vector<std::pair<NodeHandle, ErasedThunk>> mDirectConnections {};
+        // Cleared by every emit, which is otherwise const.
+        mutable std::vector<std::pair<NodeHandle, CoroutineId>> mWaiters {};
+
+        void dropExpired() noexcept {
+            std::erase_if(mConnections, [](const auto& pair) { return !pair.first; });
+            std::erase_if(mDirectConnections, [](const auto& pair) { return !pair.first; });
+            std::erase_if(mWaiters, [](const auto& pair) { return !pair.first; });
+        }
     };
 
     template <typename... Args>
     class AbstractSignal : public BaseSignal {
+        using Thunk = void (*)(Node*, Args...);
+
+        template <std::derived_from<Node> T, auto Method>
+        static void directCall(Node* node, Args... args) {
+            (static_cast<T*>(node)->*Method)(args...);
+        }
+
+        template <std::derived_from<Node> T, auto Method>
+        static void deferredCall(Node* node, Args... args) {
+            static_cast<T*>(node)->template callDeferred<Method>(args...);
+        }
     public:
         constexpr AbstractSignal() noexcept = default;
 
+        using BaseSignal::connect;
+        using BaseSignal::disconnect;
+
+        // Calls Method directly, without going through the reflective method bindings.
+        // Direct connections are made from code, so they are not serialised.
+        template <auto Method, std::derived_from<Node> T>
+        requires (std::is_invocable_v<decltype(Method), T&, Args...>)
+        void connect(T& node) {
+            dropExpired();
+            mDirectConnections.emplace_back(node.getHandle(), reinterpret_cast<ErasedThunk>(&directCall<T, Method>));
+        }
+
+        // As connect, but Method runs when the node's Root flushes its call queue, with repeated emits
+        // carrying the same arguments in one frame coalesced into a single call.
+        template <auto Method, std::derived_from<Node> T>
+        requires (std::is_invocable_v<decltype(Method), T&, Args...>)
+        void connectDeferred(T& node) {
+            dropExpired();
+            mDirectConnections.emplace_back(node.getHandle(), reinterpret_cast<ErasedThunk>(&deferredCall<T, Method>));
+        }
+
+        // Removes both immediate and deferred connections to Method.
+        template <auto Method, std::derived_from<Node> T>
+        void disconnect(T& node) {
+            const NodeHandle handle = node.getHandle();
+            const auto thunk = reinterpret_cast<ErasedThunk>(&directCall<T, Method>);
+            const auto deferredThunk = reinterpret_cast<ErasedThunk>(&deferredCall<T, Method>);
+            std::erase_if(mDirectConnections, [&](auto& pair) {
+                return pair.first == handle && (pair.second == thunk || pair.second == deferredThunk);
+            });
+        }
+
+        // Direct connections are called first, then waiting coroutines, then reflective connections.
         void emit([[maybe_unused]] Args... args) const {
+            for (const auto& [handle, thunk] : mDirectConnections) {
+                if (Node* node = handle.get())
+                    reinterpret_cast<Thunk>(thunk)(node, args...);
+            }
+
+            // Taken first, as resumed coroutines may wait on this signal again.
+            if (!mWaiters.empty()) {
+                for (const auto& [owner, id] : std::exchange(mWaiters, {}))
+                    CoroutineScheduler::wake(owner, id);
+            }
+
+            if (mConnections.empty())
+                return;
+
             Debug::log<1>("Emitting Signal... Caught by {} listeners.", mConnections.size());
-            for (const auto& [node, connection]: mConnections) {
-                std::ignore = connection->autoCall(node, args...);
+            for (const auto& [handle, connection]: mConnections) {
+                if (Node* node = handle.get())
+                    std::ignore = connection->autoCall(node, args...);
             }
         }
     private:
@@ -75,13 +151,19 @@ namespace M3DS {
             Debug::log<1>("Serialising signal...");
             {
                 const SerialisationHeader header {
-                    .connections = static_cast<std::uint16_t>(mConnections.size())
+                    .connections = static_cast<std::uint16_t>(std::ranges::count_if(mConnections, [](const auto& pair) {
+                        return static_cast<bool>(pair.first);
+                    }))
                 };
                 if (!serialiser.write(header))
                     return Failure{ ErrorCode::file_write_fail };
             }
 
-            for (const auto& [node, connection] : mConnections) {
+            for (const auto& [handle, connection] : mConnections) {
+                const Node* node = handle.get();
+                if (!node)
+                    continue;
+
                 const NodePath path = owner->getPathTo(node);
 
                 if (path.empty())
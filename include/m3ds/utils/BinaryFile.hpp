@@ -1,12 +1,18 @@
 #pragma once
 
+#include <cstddef>
+#include <cstring>
 #include <filesystem>
 #include <optional>
+#include <span>
+#include <vector>
 
 namespace M3DS {
     class BinaryFileAccessor;
     class BinaryInFileAccessor;
     class BinaryOutFileAccessor;
+    class BinaryInMemory;
+    class BinaryOutMemory;
 
     template <typename T>
     concept TrivialIOType =
@@ -103,6 +109,34 @@ namespace M3DS {
         std::unique_ptr<std::FILE, decltype([](std::FILE* file) { if (file) std::fclose(file); })> mFile;
     };
 
+    // A buffer read through the same accessors as a file, without going through stdio.
+    class BinaryInMemory {
+        friend class BinaryInFileAccessor;
+    public:
+        [[nodiscard]] explicit BinaryInMemory(std::span<const std::byte> data) noexcept;
+
+        [[nodiscard]] BinaryInFileAccessor getAccessor() & noexcept;
+    private:
+        [[nodiscard]] bool read(void* to, std::size_t size) noexcept;
+
+        std::span<const std::byte> mData {};
+        std::size_t mPosition {};
+    };
+
+    // A growable buffer written through the same accessors as a file. Seeking back overwrites in place.
+    class BinaryOutMemory {
+        friend class BinaryOutFileAccessor;
+    public:
+        [[nodiscard]] explicit BinaryOutMemory(std::vector<std::byte>& data) noexcept;
+
+        [[nodiscard]] BinaryOutFileAccessor getAccessor() & noexcept;
+    private:
+        [[nodiscard]] bool write(const void* from, std::size_t size);
+
+        std::vector<std::byte>* mData {};
+        std::size_t mPosition {};
+    };
+
     // A view onto the file held by BinaryFile
     class BinaryFileAccessor {
         friend class BinaryFile;
@@ -126,6 +160,7 @@ namespace M3DS {
 
     class BinaryInFileAccessor {
         friend class BinaryInFile;
+        friend class BinaryInMemory;
     public:
         [[nodiscard]] constexpr BinaryInFileAccessor(BinaryFileAccessor ref) noexcept;
 
@@ -137,11 +172,14 @@ namespace M3DS {
         [[nodiscard]] long length() const noexcept;
     private:
         [[nodiscard]] explicit constexpr BinaryInFileAccessor(FILE* file) noexcept;
-        FILE* mFile;
+        [[nodiscard]] explicit constexpr BinaryInFileAccessor(BinaryInMemory* memory) noexcept;
+        FILE* mFile {};
+        BinaryInMemory* mMemory {};
     };
 
     class BinaryOutFileAccessor {
         friend class BinaryOutFile;
+        friend class BinaryOutMemory;
     public:
         [[nodiscard]] constexpr BinaryOutFileAccessor(BinaryFileAccessor ref) noexcept;
 
@@ -154,7 +192,9 @@ namespace M3DS {
         [[nodiscard]] long length() const noexcept;
     private:
         [[nodiscard]] explicit constexpr BinaryOutFileAccessor(FILE* file) noexcept;
-        FILE* mFile;
+        [[nodiscard]] explicit constexpr BinaryOutFileAccessor(BinaryOutMemory* memory) noexcept;
+        FILE* mFile {};
+        BinaryOutMemory* mMemory {};
     };
 }
 
@@ -251,8 +291,6 @@ namespace M3DS {
         return false;
     }
 
-
-
     inline BinaryInFile::BinaryInFile(const std::filesystem::path& path) noexcept : mFile(
 #ifdef _WIN32
             _wfopen(path.c_str(), L"rb")
@@ -406,7 +444,6 @@ namespace M3DS {
         return false;
     }
 
-
     constexpr FILE* BinaryFileAccessor::getNativeHandle() const noexcept {
         return mFile;
     }
@@ -461,11 +498,13 @@ namespace M3DS {
         // Sanitise booleans
         if constexpr (std::same_as<T, bool>) {
             std::uint8_t val {};
-            if (std::fread(&val, sizeof(val), 1, mFile) != 1)
+            if (!read(val))
                 return false;
             to = static_cast<T>(val);
             return true;
         } else {
+            if (mMemory)
+                return mMemory->read(&to, sizeof(T));
             return std::fread(&to, sizeof(T), 1, mFile) == 1;
         }
     }
@@ -480,12 +519,16 @@ namespace M3DS {
             }
             return true;
         } else {
+            if (mMemory)
+                return mMemory->read(to.data(), to.size_bytes());
             return std::fread(to.data(), sizeof(T), to.size(), mFile) == to.size();
         }
     }
 
     template <TrivialIOType T>
     bool BinaryOutFileAccessor::write(const T& to) const noexcept {
+        if (mMemory)
+            return mMemory->write(&to, sizeof(T));
         return std::fwrite(&to, sizeof(T), 1, mFile) == 1;
     }
 
@@ -496,6 +539,8 @@ namespace M3DS {
 
     template <TrivialIOType T>
     bool BinaryOutFileAccessor::write(std::span<const T> to) const noexcept {
+        if (mMemory)
+            return mMemory->write(to.data(), to.size_bytes());
         return std::fwrite(to.data(), sizeof(T), to.size(), mFile) == to.size();
     }
 
@@ -515,15 +560,30 @@ namespace M3DS {
         return size;
     }
 
+    // Shared by both memory buffers, which only move within [0, size].
+    [[nodiscard]] inline bool seekMemory(std::size_t& position, const std::size_t size, const long offset, const std::ios_base::seekdir dir) noexcept {
+        const long base = dir == std::ios_base::beg ? 0 : static_cast<long>(dir == std::ios_base::cur ? position : size);
+        if (offset < -base || offset > static_cast<long>(size) - base)
+            return false;
+        position = static_cast<std::size_t>(base + offset);
+        return true;
+    }
+
     inline bool BinaryInFileAccessor::seek(const long offset, const std::ios_base::seekdir dir) const noexcept {
+        if (mMemory)
+            return seekMemory(mMemory->mPosition, mMemory->mData.size(), offset, dir);
         return std::fseek(mFile, offset, dir) == 0;
     }
 
     inline long BinaryInFileAccessor::tell() const noexcept {
+        if (mMemory)
+            return static_cast<long>(mMemory->mPosition);
         return std::ftell(mFile);
     }
 
     inline long BinaryInFileAccessor::length() const noexcept {
+        if (mMemory)
+            return static_cast<long>(mMemory->mData.size());
         const auto pos = std::ftell(mFile);
         std::fseek(mFile, 0, std::ios::end);
         const auto size = std::ftell(mFile);
@@ -532,14 +592,20 @@ namespace M3DS {
     }
 
     inline bool BinaryOutFileAccessor::seek(const long offset, const std::ios_base::seekdir dir) const noexcept {
+        if (mMemory)
+            return seekMemory(mMemory->mPosition, mMemory->mData->size(), offset, dir);
         return std::fseek(mFile, offset, dir) == 0;
     }
 
     inline long BinaryOutFileAccessor::tell() const noexcept {
+        if (mMemory)
+            return static_cast<long>(mMemory->mPosition);
         return std::ftell(mFile);
     }
 
     inline long BinaryOutFileAccessor::length() const noexcept {
+        if (mMemory)
+            return static_cast<long>(mMemory->mData->size());
         const auto pos = std::ftell(mFile);
         std::fseek(mFile, 0, std::ios::end);
         const auto size = std::ftell(mFile);
@@ -547,10 +613,41 @@ namespace M3DS {
         return size;
     }
 
-
     constexpr BinaryInFileAccessor::BinaryInFileAccessor(const BinaryFileAccessor ref) noexcept : mFile(ref.getNativeHandle()) {}
     constexpr BinaryInFileAccessor::BinaryInFileAccessor(FILE* file) noexcept : mFile(file) {}
+    constexpr BinaryInFileAccessor::BinaryInFileAccessor(BinaryInMemory* memory) noexcept : mMemory(memory) {}
 
     constexpr BinaryOutFileAccessor::BinaryOutFileAccessor(const BinaryFileAccessor ref) noexcept : mFile(ref.getNativeHandle()) {}
     constexpr BinaryOutFileAccessor::BinaryOutFileAccessor(FILE* file) noexcept : mFile(file) {}
+    constexpr BinaryOutFileAccessor::BinaryOutFileAccessor(BinaryOutMemory* memory) noexcept : mMemory(memory) {}
+
+    inline BinaryInMemory::BinaryInMemory(const std::span<const std::byte> data) noexcept : mData(data) {}
+
+    inline BinaryInFileAccessor BinaryInMemory::getAccessor() & noexcept {
+        return BinaryInFileAccessor{ this };
+    }
+
+    inline bool BinaryInMemory::read(void* to, const std::size_t size) noexcept {
+        if (size > mData.size() - mPosition)
+            return false;
+        if (size)
+            std::memcpy(to, mData.data() + mPosition, size);
+        mPosition += size;
+        return true;
+    }
+
+    inline BinaryOutMemory::BinaryOutMemory(std::vector<std::byte>& data) noexcept : mData(&data) {}
+
+    inline BinaryOutFileAccessor BinaryOutMemory::getAccessor() & noexcept {
+        return BinaryOutFileAccessor{ this };
+    }
+
+    inline bool BinaryOutMemory::write(const void* from, const std::size_t size) {
+        if (mPosition + size > mData->size())
+            mData->resize(mPosition + size);
+        if (size)
+            std::memcpy(mData->data() + mPosition, from, size);
+        mPosition += size;
+        return true;
+    }
 }
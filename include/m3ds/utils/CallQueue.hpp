@@ -0,0 +1,79 @@
+#pragma once
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include <m3ds/types/NodeHandle.hpp>
+
+namespace M3DS {
+    class Node;
+
+    // Calls queued during a frame and run together at a fixed point in the main loop, so listeners can
+    // free or reparent nodes without invalidating whatever emitted them. Arguments are stored inline and
+    // the buffers keep their capacity between frames, so queueing does not allocate once warmed up.
+    // Identical calls, same node, method and arguments, queued in one frame run once. Calls hold their node
+    // through a NodeHandle, so they survive it leaving the tree and being re-added, and are only dropped once it is destroyed.
+    class CallQueue {
+    public:
+        static constexpr std::size_t argCapacity = 16;
+
+        using Invoke = void (*)(Node*, const std::byte*);
+
+        template <std::derived_from<Node> T, auto Method, typename... Args>
+        static void invoke(Node* node, const std::byte* args);
+
+        template <typename... Args>
+        void push(NodeHandle target, Invoke invoke, const Args&... args);
+
+        // Calls queued while flushing run on the next flush, so a call re-queueing itself cannot stall the frame.
+        void flush();
+
+        [[nodiscard]] bool empty() const noexcept;
+    private:
+        struct Call {
+            NodeHandle target {};
+            Invoke invoke {};
+            alignas(std::max_align_t) std::array<std::byte, argCapacity> args {};
+        };
+
+        std::vector<Call> mCalls {};
+        std::vector<Call> mRunning {};
+        std::vector<std::uint32_t> mOrder {};
+
+        void enqueue(const Call& call);
+        void coalesce() noexcept;
+    };
+}
+
+/* Implementation */
+namespace M3DS {
+    template <std::derived_from<Node> T, auto Method, typename... Args>
+    void CallQueue::invoke(Node* node, const std::byte* args) {
+        const auto& tuple = *std::launder(reinterpret_cast<const std::tuple<Args...>*>(args));
+        std::apply(
+            [node](const Args&... unpacked) {
+                (static_cast<T*>(node)->*Method)(unpacked...);
+            },
+            tuple
+        );
+    }
+
+    template <typename... Args>
+    void CallQueue::push(const NodeHandle target, const Invoke invoke, const Args&... args) {
+        using Tuple = std::tuple<Args...>;
+
+        // Arguments are copied and compared bytewise, and never destroyed.
+        static_assert((std::is_trivially_copyable_v<Args> && ...));
+        static_assert(sizeof(Tuple) <= argCapacity && alignof(Tuple) <= alignof(std::max_align_t));
+
+        Call call { target, invoke };
+        std::construct_at(reinterpret_cast<Tuple*>(call.args.data()), args...);
+        enqueue(call);
+    }
+}
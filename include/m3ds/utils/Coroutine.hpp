@@ -0,0 +1,192 @@
+#pragma once
+
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include <m3ds/types/NodeHandle.hpp>
+#include <m3ds/utils/Units.hpp>
+
+namespace M3DS {
+    class Node;
+    class CoroutineScheduler;
+
+    class CoroutineId {
+    public:
+        constexpr CoroutineId() noexcept = default;
+
+        [[nodiscard]] explicit constexpr operator bool() const noexcept;
+
+        constexpr bool operator==(const CoroutineId& other) const noexcept = default;
+    private:
+        friend class CoroutineScheduler;
+
+        static constexpr std::uint32_t noIndex = std::numeric_limits<std::uint32_t>::max();
+
+        std::uint32_t mIndex = noIndex;
+        std::uint32_t mGeneration {};
+
+        constexpr CoroutineId(std::uint32_t index, std::uint32_t generation) noexcept;
+    };
+
+    // Return type of script coroutines, which do nothing until started with Node::startCoroutine.
+    // Frames are allocated from NodePool, so starting one does not allocate once its size has been seen.
+    class Coroutine {
+    public:
+        struct promise_type {
+            CoroutineScheduler* scheduler {};
+            NodeHandle owner {};
+            CoroutineId id {};
+
+            [[nodiscard]] static void* operator new(std::size_t size) noexcept;
+            static void operator delete(void* ptr, std::size_t size) noexcept;
+
+            [[nodiscard]] static Coroutine get_return_object_on_allocation_failure() noexcept;
+            [[nodiscard]] Coroutine get_return_object() noexcept;
+
+            [[nodiscard]] std::suspend_always initial_suspend() const noexcept { return {}; }
+            // The scheduler destroys finished frames.
+            [[nodiscard]] std::suspend_always final_suspend() const noexcept { return {}; }
+
+            void return_void() const noexcept {}
+            [[noreturn]] void unhandled_exception() const noexcept { std::terminate(); }
+        };
+
+        using Handle = std::coroutine_handle<promise_type>;
+
+        constexpr Coroutine() noexcept = default;
+        ~Coroutine() noexcept;
+
+        Coroutine(const Coroutine&) = delete;
+        Coroutine& operator=(const Coroutine&) = delete;
+
+        Coroutine(Coroutine&& other) noexcept;
+        Coroutine& operator=(Coroutine&& other) noexcept;
+
+        // False when the frame could not be allocated.
+        [[nodiscard]] explicit operator bool() const noexcept;
+    private:
+        friend class CoroutineScheduler;
+
+        Handle mHandle {};
+
+        explicit Coroutine(Handle handle) noexcept;
+    };
+
+    // Coroutines of every script in a tree. Sleeping coroutines are only touched when what they wait for
+    // happens: a frame passing, a timer on Root's timer wheel or a signal being emitted.
+    class CoroutineScheduler {
+    public:
+        CoroutineScheduler() noexcept = default;
+        ~CoroutineScheduler() noexcept;
+
+        CoroutineScheduler(const CoroutineScheduler&) = delete;
+        CoroutineScheduler& operator=(const CoroutineScheduler&) = delete;
+
+        // Runs coroutine up to its first wait, from the first frame owner processes in.
+        // It is stopped once owner leaves the tree, and never started outside it.
+        CoroutineId start(Node& owner, Coroutine coroutine);
+
+        // A coroutine stopping itself is destroyed once it next waits.
+        void stop(CoroutineId id) noexcept;
+        // Stops every coroutine started on owner.
+        void cancel(const Node* owner) noexcept;
+
+        [[nodiscard]] bool isRunning(CoroutineId id) const noexcept;
+
+        // Takes the coroutines waiting for the next frame, for resumeFrame to resume. Those that start waiting
+        // after this, even from resumeFrame, go on to the frame after.
+        void beginFrame() noexcept;
+        void resumeFrame();
+        void waitFrame(CoroutineId id);
+        // Does nothing if the coroutine has finished or been stopped, and waits for a frame its owner processes in.
+        void resume(CoroutineId id);
+
+        // Resumes id on the scheduler of the tree owner is in, for wake ups that outlive the coroutine.
+        static void wake(NodeHandle owner, CoroutineId id);
+        // Timer wheel callback, taking the id as its argument.
+        static void wakeTimer(Node* owner, const std::byte* args);
+    private:
+        struct Entry {
+            Coroutine::Handle handle {};
+            // Only set while the owner is in the tree, as leaving it stops the coroutine, even one that is running.
+            Node* owner {};
+            std::uint32_t generation {};
+            bool running {};
+            bool stopping {};
+        };
+
+        std::vector<Entry> mEntries {};
+        std::vector<std::uint32_t> mFreeEntries {};
+
+        std::vector<CoroutineId> mNextFrame {};
+        std::vector<CoroutineId> mResuming {};
+
+        [[nodiscard]] const Entry* find(CoroutineId id) const noexcept;
+        [[nodiscard]] Entry* find(CoroutineId id) noexcept;
+        void destroy(std::uint32_t index) noexcept;
+    };
+
+    struct NextFrame {
+        [[nodiscard]] bool await_ready() const noexcept { return false; }
+        void await_suspend(Coroutine::Handle handle) const;
+        void await_resume() const noexcept {}
+    };
+
+    struct WaitSeconds {
+        Seconds<float> delay {};
+
+        [[nodiscard]] bool await_ready() const noexcept { return delay <= 0.f; }
+        void await_suspend(Coroutine::Handle handle) const;
+        void await_resume() const noexcept {}
+    };
+
+    template <typename SignalType>
+    struct WaitSignal {
+        SignalType& signal;
+
+        [[nodiscard]] bool await_ready() const noexcept { return false; }
+        void await_suspend(Coroutine::Handle handle) const;
+        void await_resume() const noexcept {}
+    };
+
+    [[nodiscard]] constexpr NextFrame nextFrame() noexcept;
+    // Counted on Root's timer wheel, so the wait keeps going while the owner is paused, resuming once it is not.
+    [[nodiscard]] constexpr WaitSeconds waitSeconds(Seconds<float> delay) noexcept;
+    // Resumes on the next emit of signal.
+    template <typename SignalType>
+    [[nodiscard]] constexpr WaitSignal<SignalType> waitSignal(SignalType& signal) noexcept;
+}
+
+/* Implementation */
+namespace M3DS {
+    constexpr CoroutineId::CoroutineId(const std::uint32_t index, const std::uint32_t generation) noexcept
+        : mIndex(index), mGeneration(generation)
+    {}
+
+    constexpr CoroutineId::operator bool() const noexcept {
+        return mIndex != noIndex;
+    }
+
+    template <typename SignalType>
+    void WaitSignal<SignalType>::await_suspend(const Coroutine::Handle handle) const {
+        signal.addWaiter(handle.promise().owner, handle.promise().id);
+    }
+
+    constexpr NextFrame nextFrame() noexcept {
+        return {};
+    }
+
+    constexpr WaitSeconds waitSeconds(const Seconds<float> delay) noexcept {
+        return { delay };
+    }
+
+    template <typename SignalType>
+    constexpr WaitSignal<SignalType> waitSignal(SignalType& signal) noexcept {
+        return { signal };
+    }
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <m3ds/utils/Interpolate.hpp>
+
+namespace M3DS {
+    // Normalised easing curves, sampled once so tweens look up eased progress instead of calling
+    // std::pow, std::cosh or std::cos every frame. Curves are linearly interpolated between samples.
+    class EasingTable {
+    public:
+        using Curve = std::uint8_t;
+
+        static constexpr std::size_t sampleCount = 256;
+
+        [[nodiscard]] static constexpr Curve getCurve(InterpolationMethod method, Easing easing) noexcept;
+
+        // Progress from 0 to 1 mapped onto the curve, equal to interpolate(0.f, 1.f, progress, method, easing).
+        [[nodiscard]] static float sample(Curve curve, float progress) noexcept;
+    private:
+        static constexpr Curve discreteCurve = 0;
+        static constexpr Curve linearCurve = 1;
+        static constexpr Curve firstSampledCurve = 2;
+
+        // Every method past linear, eased in, out and in_out.
+        static constexpr std::size_t sampledCurveCount = (std::to_underlying(InterpolationMethod::exponential) - 1) * 3;
+
+        using Samples = std::array<float, sampleCount + 1>;
+        static const std::array<Samples, sampledCurveCount> mSamples;
+    };
+
+    constexpr EasingTable::Curve EasingTable::getCurve(const InterpolationMethod method, const Easing easing) noexcept {
+        if (method == InterpolationMethod::linear || easing == Easing::none)
+            return linearCurve;
+        if (method == InterpolationMethod::discrete)
+            return discreteCurve;
+
+        return static_cast<Curve>(
+            firstSampledCurve +
+            (std::to_underlying(method) - std::to_underlying(InterpolationMethod::square)) * 3 +
+            std::to_underlying(easing) - 1
+        );
+    }
+}
@@ -9,6 +9,7 @@ extern "C" {
 
 #include <m3ds/utils/Debug.hpp>
 #include <m3ds/containers/HeapArray.hpp>
+#include <m3ds/render/GpuLock.hpp>
 
 namespace M3DS {
 	template <typename T>
@@ -22,7 +23,11 @@ namespace M3DS {
 
 		static T* allocate(const std::size_t n) {
 			const auto bytes = n * sizeof(T);
-			T* ptr = static_cast<T*>(linearAlloc(bytes));
+			T* ptr {};
+			{
+				const GpuLock lock {};
+				ptr = static_cast<T*>(linearAlloc(bytes));
+			}
 			if constexpr (logAllocations) {
 				// ReSharper disable once CppDFAUnreachableCode
 				if (ptr) {
@@ -49,6 +54,7 @@ namespace M3DS {
 					Debug::log( "LinDealloc {}B ({}B used)", bytes, allocation);
 				}
 			}
+			const GpuLock lock {};
 			linearFree(ptr);
 		}
 	};
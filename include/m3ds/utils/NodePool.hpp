@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace M3DS {
+    // Slab allocator backing every Node allocation, with one pool per object size, so each
+    // concrete node class effectively gets its own. Freed nodes go onto a free list and are
+    // reused instead of returning to the heap. Not thread-safe: nodes are created and freed
+    // by whichever thread is updating the tree.
+    class NodePool {
+    public:
+        struct Stats {
+            std::size_t objectSize {};
+            std::size_t capacity {};
+            std::size_t used {};
+            std::size_t peak {};
+            std::size_t slabs {};
+        };
+
+        // Objects larger than this go straight to the heap.
+        static constexpr std::size_t maxPooledSize = 1024;
+        static constexpr std::size_t granularity = alignof(std::max_align_t);
+
+        [[nodiscard]] static void* allocate(std::size_t size) noexcept;
+        static void deallocate(void* ptr, std::size_t size) noexcept;
+
+        // Makes room for at least count objects of T, so spawning them later does not allocate.
+        template <typename T>
+        static bool reserve(std::size_t count) noexcept;
+        static bool reserve(std::size_t size, std::size_t count) noexcept;
+
+        template <typename T>
+        [[nodiscard]] static Stats getStats() noexcept;
+        [[nodiscard]] static Stats getStats(std::size_t size) noexcept;
+        // Stats for every size that has been allocated from.
+        [[nodiscard]] static std::vector<Stats> getAllStats();
+
+        // Releases pools that currently hold no live objects.
+        static void trim() noexcept;
+    };
+
+    template <typename T>
+    bool NodePool::reserve(const std::size_t count) noexcept {
+        return reserve(sizeof(T), count);
+    }
+
+    template <typename T>
+    NodePool::Stats NodePool::getStats() noexcept {
+        return getStats(sizeof(T));
+    }
+}
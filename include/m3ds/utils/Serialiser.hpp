@@ -2,11 +2,22 @@
 
 #include <vector>
 #include <functional>
+#include <memory>
 
 #include <m3ds/utils/BinaryFile.hpp>
 #include <m3ds/utils/Debug.hpp>
 
 namespace M3DS {
+    class Object;
+    using ObjectInstantiator = std::unique_ptr<Object> (*)();
+
+    // What a deserialisation pass resolved by name or path, recorded so the same bytes can be read again without
+    // looking classes up, and without reloading resources once every object using them is gone.
+    struct DeserialiseCache {
+        std::vector<ObjectInstantiator> classes {};
+        std::vector<std::shared_ptr<const void>> resources {};
+    };
+
     class Deferrer {
     public:
         [[nodiscard]] constexpr Deferrer() noexcept = default;
@@ -31,8 +42,23 @@ namespace M3DS {
 
     class Deserialiser : public BinaryInFileAccessor, public Deferrer {
         std::vector<std::move_only_function<void()>> mDeferred {};
+        DeserialiseCache* mRecording {};
+        const DeserialiseCache* mReplaying {};
+        std::size_t mReplayedClasses {};
     public:
         [[nodiscard]] explicit Deserialiser(BinaryInFileAccessor file) noexcept;
+
+        // Fills cache while reading.
+        void record(DeserialiseCache& cache) noexcept;
+        // Takes classes from a cache recorded over the same bytes, in the order they were read.
+        void replay(const DeserialiseCache& cache) noexcept;
+
+        [[nodiscard]] bool isReplaying() const noexcept;
+        // Null once the recorded classes run out.
+        [[nodiscard]] ObjectInstantiator replayClass() noexcept;
+        void recordClass(ObjectInstantiator instantiator);
+        // Keeps a loaded resource alive for as long as the cache being recorded.
+        void retain(std::shared_ptr<const void> resource);
     };
 }
 
@@ -62,4 +88,35 @@ namespace M3DS {
     inline Deserialiser::Deserialiser(const BinaryInFileAccessor file) noexcept
         : BinaryInFileAccessor(file)
     {}
+
+    inline void Deserialiser::record(DeserialiseCache& cache) noexcept {
+        mRecording = &cache;
+        mReplaying = nullptr;
+    }
+
+    inline void Deserialiser::replay(const DeserialiseCache& cache) noexcept {
+        mReplaying = &cache;
+        mRecording = nullptr;
+        mReplayedClasses = 0;
+    }
+
+    inline bool Deserialiser::isReplaying() const noexcept {
+        return mReplaying;
+    }
+
+    inline ObjectInstantiator Deserialiser::replayClass() noexcept {
+        if (!mReplaying || mReplayedClasses >= mReplaying->classes.size())
+            return nullptr;
+        return mReplaying->classes[mReplayedClasses++];
+    }
+
+    inline void Deserialiser::recordClass(const ObjectInstantiator instantiator) {
+        if (mRecording)
+            mRecording->classes.emplace_back(instantiator);
+    }
+
+    inline void Deserialiser::retain(std::shared_ptr<const void> resource) {
+        if (mRecording && resource)
+            mRecording->resources.emplace_back(std::move(resource));
+    }
 }
@@ -0,0 +1,143 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include <m3ds/types/NodeHandle.hpp>
+#include <m3ds/utils/CallQueue.hpp>
+#include <m3ds/utils/Units.hpp>
+
+namespace M3DS {
+    class Node;
+
+    // Hierarchical timing wheel running delayed calls on nodes. Timers are filed by expiry into levels of
+    // slotCount slots, each level covering slotCount times the span of the one below, and only move down
+    // a level when the slot they are in comes up. Scheduling and cancelling are O(1), and advancing
+    // only touches slots holding timers that are due or about to cascade.
+    // Calls on nodes freed before their timer expires are dropped.
+    class TimerWheel {
+    public:
+        static constexpr float ticksPerSecond = 1024.f;
+        static constexpr std::uint16_t maxChainFires = 4;
+
+        using Invoke = CallQueue::Invoke;
+
+        class Id {
+        public:
+            constexpr Id() noexcept = default;
+
+            [[nodiscard]] explicit constexpr operator bool() const noexcept;
+
+            constexpr bool operator==(const Id& other) const noexcept = default;
+        private:
+            friend class TimerWheel;
+
+            std::uint32_t mIndex = noIndex;
+            std::uint32_t mGeneration {};
+
+            constexpr Id(std::uint32_t index, std::uint32_t generation) noexcept;
+        };
+
+        // Timers fire on the first tick at or after delay. Calls made by a firing timer count from the exact time
+        // it was due rather than the tick it fired on, so timers rescheduling themselves do not drift. Such a chain
+        // fires at most maxChainFires times in one advance, then waits for the next, dropping the time it fell behind.
+        template <typename... Args>
+        Id schedule(Seconds<float> delay, Node& target, Invoke invoke, const Args&... args);
+
+        // Returns whether the timer was still pending.
+        bool cancel(Id id) noexcept;
+
+        [[nodiscard]] bool isPending(Id id) const noexcept;
+        // Zero once the timer has fired or been cancelled.
+        [[nodiscard]] Seconds<float> getTimeLeft(Id id) const noexcept;
+
+        void advance(Seconds<float> delta);
+    private:
+        static constexpr std::uint32_t noIndex = std::numeric_limits<std::uint32_t>::max();
+
+        static constexpr std::size_t slotBits = 6;
+        static constexpr std::size_t slotCount = 1 << slotBits;
+        static constexpr std::size_t levelCount = 4;
+
+        struct Timer {
+            std::uint64_t expiry {};
+            // Ticks between the exact expiry and the tick it was rounded up to, in [0, 1].
+            float lateness {};
+            // The advance a firing timer scheduled this one in, and how many timers of its chain fired in it before.
+            std::uint32_t chainAdvance {};
+            std::uint16_t chainFires {};
+            NodeHandle target {};
+            // Null while the entry is free.
+            Invoke invoke {};
+            std::uint32_t generation {};
+            // Links within the slot holding the timer, or the free list.
+            std::uint32_t prev = noIndex;
+            std::uint32_t next = noIndex;
+            std::uint16_t slot {};
+            alignas(std::max_align_t) std::array<std::byte, CallQueue::argCapacity> args {};
+        };
+
+        std::vector<Timer> mTimers {};
+        std::uint32_t mFreeTimers = noIndex;
+
+        std::array<std::uint32_t, levelCount * slotCount> mSlots = makeEmptySlots();
+        std::uint64_t mNow {};
+        float mTickFraction {};
+
+        // The last tick and count of the current or last advance.
+        std::uint64_t mAdvanceTarget {};
+        std::uint32_t mAdvanceCount {};
+
+        // Set while a timer's call runs, for timers it schedules to carry on from it.
+        bool mFiring {};
+        float mFiringLateness {};
+        std::uint16_t mFiringChain {};
+
+        static constexpr std::array<std::uint32_t, levelCount * slotCount> makeEmptySlots() noexcept;
+
+        Id insert(Seconds<float> delay, Node& target, Invoke invoke, const std::byte* args);
+        [[nodiscard]] const Timer* find(Id id) const noexcept;
+
+        void link(std::uint32_t index) noexcept;
+        void unlink(std::uint32_t index) noexcept;
+        void release(std::uint32_t index) noexcept;
+
+        void cascade(std::size_t level);
+        void expire();
+    };
+}
+
+/* Implementation */
+namespace M3DS {
+    constexpr TimerWheel::Id::Id(const std::uint32_t index, const std::uint32_t generation) noexcept
+        : mIndex(index), mGeneration(generation)
+    {}
+
+    constexpr TimerWheel::Id::operator bool() const noexcept {
+        return mIndex != noIndex;
+    }
+
+    constexpr auto TimerWheel::makeEmptySlots() noexcept -> std::array<std::uint32_t, levelCount * slotCount> {
+        std::array<std::uint32_t, levelCount * slotCount> slots {};
+        slots.fill(noIndex);
+        return slots;
+    }
+
+    template <typename... Args>
+    auto TimerWheel::schedule(const Seconds<float> delay, Node& target, const Invoke invoke, const Args&... args) -> Id {
+        using Tuple = std::tuple<Args...>;
+
+        static_assert((std::is_trivially_copyable_v<Args> && ...));
+        static_assert(sizeof(Tuple) <= CallQueue::argCapacity && alignof(Tuple) <= alignof(std::max_align_t));
+
+        alignas(std::max_align_t) std::array<std::byte, CallQueue::argCapacity> buffer {};
+        std::construct_at(reinterpret_cast<Tuple*>(buffer.data()), args...);
+        return insert(delay, target, invoke, buffer.data());
+    }
+}
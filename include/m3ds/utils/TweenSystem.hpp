@@ -0,0 +1,182 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <m3ds/types/NodeHandle.hpp>
+#include <m3ds/types/TypePack.hpp>
+#include <m3ds/utils/EasingTable.hpp>
+#include <m3ds/utils/Units.hpp>
+#include <m3ds/utils/binding/BoundMember.hpp>
+
+namespace M3DS {
+    class Node;
+    class Object;
+
+    // Every running tween of a tree, advanced together once per frame. Tweens are grouped into sequences
+    // of steps, where the tweens of a step run in parallel and each step starts once the one before it
+    // has finished. Tweens are stored by value type in parallel arrays, so a frame walks each array once.
+    // A sequence belongs to a node and is dropped, without finishing, if the node is freed first. The
+    // objects it tweens must outlive it.
+    class TweenSystem {
+    public:
+        using Finished = void (*)(Node& owner);
+
+        class Id {
+        public:
+            constexpr Id() noexcept = default;
+
+            [[nodiscard]] explicit constexpr operator bool() const noexcept;
+
+            constexpr bool operator==(const Id& other) const noexcept = default;
+        private:
+            friend class TweenSystem;
+
+            std::uint32_t mIndex = noIndex;
+            std::uint32_t mGeneration {};
+
+            constexpr Id(std::uint32_t index, std::uint32_t generation) noexcept;
+        };
+
+        // Sequences without tweens finish on the next frame.
+        [[nodiscard]] Id create(Node& owner, Finished finished = nullptr);
+
+        // Adds a tween to the last step of sequence, reading the starting value when the step starts.
+        template <typename T>
+        void add(
+            Id sequence,
+            Object* object,
+            const Member<T>* member,
+            T to,
+            Seconds<float> duration,
+            InterpolationMethod method = InterpolationMethod::linear,
+            Easing easing = Easing::in_out
+        );
+
+        // Tweens added to sequence after this start once every tween added before it has finished.
+        void chain(Id sequence) noexcept;
+
+        // Stops the sequence where it is, without finishing it.
+        void kill(Id sequence) noexcept;
+        void setPaused(Id sequence, bool paused) noexcept;
+
+        [[nodiscard]] bool isRunning(Id sequence) const noexcept;
+
+        void advance(Seconds<float> delta);
+    private:
+        static constexpr std::uint32_t noIndex = std::numeric_limits<std::uint32_t>::max();
+
+        struct Sequence {
+            NodeHandle owner {};
+            Finished finished {};
+
+            Seconds<float> elapsed {};
+            Seconds<float> stepStart {};
+            Seconds<float> stepEnd {};
+
+            std::uint32_t remaining {};
+            std::uint32_t generation {};
+
+            bool active {};
+            bool paused {};
+            bool killed {};
+        };
+
+        template <typename T>
+        struct Lane {
+            std::vector<Object*> objects {};
+            std::vector<const Member<T>*> members {};
+            std::vector<T> from {};
+            std::vector<T> to {};
+            std::vector<Seconds<float>> starts {};
+            std::vector<float> inverseDurations {};
+            std::vector<EasingTable::Curve> curves {};
+            std::vector<std::uint32_t> sequences {};
+            // Whether from has been read, once the tween's step started.
+            std::vector<std::uint8_t> started {};
+
+            void swapRemove(std::size_t idx) noexcept;
+        };
+
+        // Indexed by position in AnimationTypes, as some of its types may be the same type.
+        AnimationTypes::transform<Lane>::apply<std::tuple> mLanes {};
+
+        std::vector<Sequence> mSequences {};
+        std::vector<std::uint32_t> mFreeSequences {};
+
+        [[nodiscard]] Sequence* find(Id id) noexcept;
+        [[nodiscard]] const Sequence* find(Id id) const noexcept;
+
+        template <typename T>
+        void advanceLane(Lane<T>& lane);
+        void finishSequences();
+    };
+}
+
+/* Implementation */
+namespace M3DS {
+    constexpr TweenSystem::Id::Id(const std::uint32_t index, const std::uint32_t generation) noexcept
+        : mIndex(index), mGeneration(generation)
+    {}
+
+    constexpr TweenSystem::Id::operator bool() const noexcept {
+        return mIndex != noIndex;
+    }
+
+    template <typename T>
+    void TweenSystem::add(
+        const Id sequence,
+        Object* object,
+        const Member<T>* member,
+        T to,
+        const Seconds<float> duration,
+        const InterpolationMethod method,
+        const Easing easing
+    ) {
+        Sequence* seq = find(sequence);
+        if (!seq || seq->killed)
+            return;
+
+        // A tween joining a step that is already running starts now rather than when the step began.
+        const Seconds<float> start = std::max(seq->stepStart, seq->elapsed);
+
+        Lane<T>& lane = std::get<AnimationTypes::indexOf<T>()>(mLanes);
+        lane.objects.emplace_back(object);
+        lane.members.emplace_back(member);
+        lane.from.emplace_back();
+        lane.to.emplace_back(std::move(to));
+        lane.starts.emplace_back(start);
+        // Zero length tweens finish on their first frame.
+        lane.inverseDurations.emplace_back(duration > 0.f ? 1.f / duration : std::numeric_limits<float>::max());
+        lane.curves.emplace_back(EasingTable::getCurve(method, easing));
+        lane.sequences.emplace_back(sequence.mIndex);
+        lane.started.emplace_back();
+
+        seq->stepEnd = std::max(seq->stepEnd, start + std::max(duration, 0.f));
+        ++seq->remaining;
+    }
+
+    template <typename T>
+    void TweenSystem::Lane<T>::swapRemove(const std::size_t idx) noexcept {
+        const auto remove = [idx]<typename U>(std::vector<U>& values) {
+            if (idx != values.size() - 1)
+                values[idx] = std::move(values.back());
+            values.pop_back();
+        };
+
+        remove(objects);
+        remove(members);
+        remove(from);
+        remove(to);
+        remove(starts);
+        remove(inverseDurations);
+        remove(curves);
+        remove(sequences);
+        remove(started);
+    }
+}
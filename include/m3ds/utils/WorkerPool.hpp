@@ -0,0 +1,144 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <type_traits>
+
+#ifdef __3DS__
+extern "C" {
+    #include <3ds/thread.h>
+    #include <3ds/synchronization.h>
+}
+#else
+#include <semaphore>
+#include <thread>
+#endif
+
+namespace M3DS {
+    // Small fixed pool of worker threads for splitting independent per-frame work.
+    // A parallelFor may be issued from inside a launched task; it then uses whichever workers are idle.
+    class WorkerPool {
+    public:
+        static constexpr std::size_t maxWorkers = 2;
+
+        WorkerPool() noexcept;
+        ~WorkerPool() noexcept;
+
+        WorkerPool(const WorkerPool&) = delete;
+        WorkerPool& operator=(const WorkerPool&) = delete;
+
+        WorkerPool(WorkerPool&&) = delete;
+        WorkerPool& operator=(WorkerPool&&) = delete;
+
+        [[nodiscard]] std::size_t getWorkerCount() const noexcept;
+
+        // Calls func(i) for every i in [0, count), blocking until all calls have returned.
+        // The calling thread takes part, so this degrades to a plain loop without idle workers.
+        // Callable from the thread owning the pool and from inside tasks running on its workers.
+        template <typename Func>
+        requires std::is_invocable_v<Func&, std::size_t>
+        void parallelFor(std::size_t count, Func&& func) noexcept;
+
+        // Runs func() on a worker while the caller continues. func must stay alive until wait().
+        // Only one launched task may be in flight; without an idle worker it runs immediately.
+        template <typename Func>
+        requires std::is_invocable_v<Func&>
+        void launch(Func& func) noexcept;
+        void wait() noexcept;
+    private:
+        class Semaphore {
+        public:
+            Semaphore() noexcept;
+
+            void acquire() noexcept;
+            void release() noexcept;
+        private:
+#ifdef __3DS__
+            LightSemaphore mSemaphore {};
+#else
+            std::counting_semaphore<> mSemaphore { 0 };
+#endif
+        };
+
+        using JobFunc = void(*)(void* context, std::size_t idx) noexcept;
+
+        struct Job {
+            JobFunc func {};
+            void* context {};
+            std::size_t count {};
+
+            std::atomic<std::size_t> next {};
+            std::atomic<std::size_t> pending {};
+            Semaphore done {};
+
+            // Only touched by the dispatching thread.
+            bool active {};
+        };
+
+        struct Worker {
+#ifdef __3DS__
+            Thread thread {};
+#else
+            std::thread thread {};
+#endif
+            WorkerPool* pool {};
+            Semaphore start {};
+            Job* job {};
+            std::atomic<bool> busy {};
+
+            // Used by parallelFor calls made from this worker.
+            Job dispatched {};
+        };
+
+        std::array<Worker, maxWorkers> mWorkers {};
+        std::size_t mWorkerCount {};
+        std::atomic<bool> mStopping {};
+
+        // Jobs live in the pool rather than on the dispatching stack, as the worker finishing a job may
+        // still be inside its release of done after the dispatcher has woken and returned.
+        Job mDispatched {};
+        static inline thread_local Worker* mCurrentWorker {};
+
+        Job mLaunched {};
+        bool mLaunchPending {};
+
+        void dispatch(JobFunc func, void* context, std::size_t count) noexcept;
+        bool assign(Job& job, std::size_t maxHelpers) noexcept;
+
+        static void runJob(Job& job) noexcept;
+        static bool finishJob(Job& job) noexcept;
+
+        static void workerMain(void* worker) noexcept;
+    };
+
+    template <typename Func>
+    requires std::is_invocable_v<Func&, std::size_t>
+    void WorkerPool::parallelFor(const std::size_t count, Func&& func) noexcept {
+        dispatch(
+            [](void* context, const std::size_t idx) noexcept {
+                std::invoke(*static_cast<std::remove_reference_t<Func>*>(context), idx);
+            },
+            const_cast<void*>(static_cast<const void*>(std::addressof(func))),
+            count
+        );
+    }
+
+    template <typename Func>
+    requires std::is_invocable_v<Func&>
+    void WorkerPool::launch(Func& func) noexcept {
+        mLaunched.func = [](void* context, std::size_t) noexcept {
+            std::invoke(*static_cast<Func*>(context));
+        };
+        mLaunched.context = const_cast<void*>(static_cast<const void*>(std::addressof(func)));
+        mLaunched.count = 1;
+        mLaunched.next.store(0, std::memory_order_relaxed);
+        mLaunched.pending.store(0, std::memory_order_relaxed);
+
+        mLaunchPending = assign(mLaunched, 1);
+        if (!mLaunchPending)
+            runJob(mLaunched);
+    }
+}
@@ -6,6 +6,7 @@
 
 #include <m3ds/types/TypePack.hpp>
 #include <m3ds/utils/ObjectPack.hpp>
+#include <m3ds/utils/binding/NameLookup.hpp>
 
 namespace M3DS {
     class Object;
@@ -178,12 +179,18 @@ namespace M3DS {
     class MethodPack {
         std::tuple<Pairs...> mMethods;
         std::array<BoundMethodPair, sizeof...(Pairs)> mArray;
+        NameLookup<sizeof...(Pairs)> mLookup;
 
         template <std::size_t... Is>
         [[nodiscard]] explicit consteval MethodPack(Pairs&&... methods, std::index_sequence<Is...>)
             : mMethods(std::forward<Pairs>(methods)...)
             , mArray{std::get<Is>(mMethods).get()...}
+            , mLookup{std::array<std::string_view, sizeof...(Pairs)>{ getName(mArray[Is])... }}
         {}
+
+        [[nodiscard]] static consteval std::string_view getName(const BoundMethodPair& pair) noexcept {
+            return pair.constMethod ? pair.constMethod->getName() : pair.mutableMethod->getName();
+        }
     public:
         [[nodiscard]] explicit consteval MethodPack(Pairs&&... methods) noexcept
             : MethodPack(std::forward<Pairs>(methods)..., std::index_sequence_for<Pairs...>())
@@ -192,5 +199,12 @@ namespace M3DS {
         [[nodiscard]] constexpr std::span<const BoundMethodPair> getMethods() const noexcept {
             return mArray;
         }
+
+        // Empty if no method has this name.
+        [[nodiscard]] constexpr BoundMethodPair find(const std::string_view name) const noexcept {
+            if (const std::size_t idx = mLookup.find(name); idx != mLookup.npos)
+                return mArray[idx];
+            return {};
+        }
     };
 }
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <string_view>
+
+namespace M3DS {
+    // Perfect hash from a fixed set of names to their indices, found at compile time.
+    // A lookup hashes the name once and confirms it with a single comparison.
+    template <std::size_t N>
+    class NameLookup {
+    public:
+        static constexpr std::size_t npos = N;
+
+        [[nodiscard]] explicit consteval NameLookup(const std::array<std::string_view, N>& names);
+
+        [[nodiscard]] constexpr std::size_t find(std::string_view name) const noexcept;
+    private:
+        static_assert(N < std::numeric_limits<std::uint8_t>::max());
+
+        // Sparse enough that a collision-free seed turns up within a few hundred tries.
+        static constexpr std::size_t slotCount = N == 0 ? 1 : std::bit_ceil(N * 4);
+
+        std::array<std::string_view, N> mNames {};
+        // Index + 1 of the name hashing to each slot, or 0 if none does.
+        std::array<std::uint8_t, slotCount> mSlots {};
+        std::uint32_t mSeed {};
+
+        [[nodiscard]] static constexpr std::size_t getSlot(std::string_view name, std::uint32_t seed) noexcept;
+        // Not constexpr, so reaching it fails compilation.
+        static void noPerfectHashFound() noexcept {}
+    };
+
+    template <typename T, std::size_t N>
+    [[nodiscard]] consteval std::array<std::string_view, N> getNames(const std::array<const T*, N>& objects) {
+        std::array<std::string_view, N> names {};
+        for (std::size_t i{}; i < N; ++i)
+            names[i] = objects[i]->getName();
+        return names;
+    }
+}
+
+/* Implementation */
+namespace M3DS {
+    template <std::size_t N>
+    consteval NameLookup<N>::NameLookup(const std::array<std::string_view, N>& names) : mNames(names) {
+        for (std::uint32_t seed{}; seed < 1u << 16; ++seed) {
+            mSlots = {};
+
+            bool collided = false;
+            for (std::size_t i{}; i < N && !collided; ++i) {
+                std::uint8_t& slot = mSlots[getSlot(names[i], seed)];
+                if (slot)
+                    collided = true;
+                else
+                    slot = static_cast<std::uint8_t>(i + 1);
+            }
+
+            if (!collided) {
+                mSeed = seed;
+                return;
+            }
+        }
+
+        // Only reachable with duplicate names.
+        noPerfectHashFound();
+    }
+
+    template <std::size_t N>
+    constexpr std::size_t NameLookup<N>::find(const std::string_view name) const noexcept {
+        if constexpr (N == 0) {
+            return npos;
+        } else {
+            const std::size_t slot = mSlots[getSlot(name, mSeed)];
+            if (slot && mNames[slot - 1] == name)
+                return slot - 1;
+            return npos;
+        }
+    }
+
+    template <std::size_t N>
+    constexpr std::size_t NameLookup<N>::getSlot(const std::string_view name, const std::uint32_t seed) noexcept {
+        // FNV-1a, with the seed folded into the offset basis.
+        std::uint32_t hash = 0x811C9DC5u ^ (seed * 0x9E3779B9u);
+        for (const char c : name) {
+            hash ^= static_cast<unsigned char>(c);
+            hash *= 0x01000193u;
+        }
+        hash ^= hash >> 16;
+        return hash & (slotCount - 1);
+    }
+}
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <algorithm>
 #include <filesystem>
+#include <optional>
 
 #include <m3ds/utils/binding/BoundMember.hpp>
 #include <m3ds/utils/binding/BoundMethod.hpp>
@@ -10,15 +12,45 @@
 #include <m3ds/reference/Resource.hpp>
 #include <m3ds/utils/BinaryFile.hpp>
 
+#include <m3ds/nodes/Node.hpp>
+
 namespace M3DS {
     class Registry {
+    public:
+        // Updates a batch of nodes of a single class, calling update() without virtual dispatch.
+        struct UpdateBatch {
+            void (*func)(std::span<Node* const> nodes, Seconds<float> delta) {};
+            bool overridesUpdate {};
+        };
+    private:
         struct Entry {
             std::unique_ptr<Object> (*uniqueInstantiator)() {};
             const GenericMember* (*getMembersFunc)(std::string_view) {};
             BoundMethodPair (*getMethodFunc)(std::string_view) {};
+            UpdateBatch updateBatch {};
+            bool overridesInput {};
         };
 
+        struct NamedEntry {
+            std::string_view name {};
+            Entry entry {};
+        };
+
+        // Sorted by name, built at compile time from a TypePack.
+        static inline std::span<const NamedEntry> mTypeTable {};
+        // Types registered one at a time at runtime.
         static inline std::flat_map<std::string_view, Entry> mRegistry {};
+
+        template <typename T>
+        [[nodiscard]] static constexpr Entry makeEntry() noexcept;
+
+        template <typename... Ts>
+        [[nodiscard]] static consteval auto makeTypeTable() noexcept;
+
+        [[nodiscard]] static constexpr const Entry* findEntry(std::string_view className) noexcept;
+
+        template <typename T>
+        static void updateBatch(std::span<Node* const> nodes, Seconds<float> delta);
     public:
         template <typename T>
         requires (!std::derived_from<T, Resource>)
@@ -28,6 +60,12 @@ namespace M3DS {
         requires (!std::derived_from<Ts, Resource> &&...)
         static constexpr void registerTypes();
 
+        // Registers a whole pack through a table sorted at compile time, so startup only stores a span.
+        // Replaces any previously registered pack, so user types should be appended to the built-in pack.
+        template <typename... Ts>
+        requires (!std::derived_from<Ts, Resource> &&...)
+        static constexpr void registerTypePack(TypePack<Ts...>) noexcept;
+
         [[nodiscard]] static constexpr std::unique_ptr<Object> instantiate(std::string_view className);
 
         [[nodiscard]] static std::expected<std::unique_ptr<Object>, Failure> deserialise(const std::filesystem::path& path) noexcept;
@@ -41,6 +79,10 @@ namespace M3DS {
         template <ObjectType O>
         [[nodiscard]] static std::expected<std::unique_ptr<O>, Failure> deserialise(Deserialiser& deserialiser) noexcept;
 
+        [[nodiscard]] static constexpr std::optional<UpdateBatch> getUpdateBatch(std::string_view className);
+        // Classes missing from the Registry are assumed to.
+        [[nodiscard]] static constexpr bool overridesInput(std::string_view className);
+
         [[nodiscard]] static constexpr const GenericMember* getMember(std::string_view className, std::string_view memberName);
         [[nodiscard]] static constexpr BoundMethodPair getMethodPair(std::string_view className, std::string_view methodName);
 
@@ -70,22 +112,70 @@ namespace M3DS {
         }
     }
 
+    template <typename T>
+    constexpr Registry::Entry Registry::makeEntry() noexcept {
+        return {
+            [] -> std::unique_ptr<Object> {
+                if constexpr (std::is_default_constructible_v<T>) {
+                    std::unique_ptr object = std::make_unique<T>();
+                    if constexpr (std::derived_from<T, Node>)
+                        object->mExactClass = std::same_as<typename T::SelfType, T>;
+                    return object;
+                } else {
+                    return {};
+                }
+            },
+            T::getMemberStatic,
+            T::getMethodStatic,
+            [] -> UpdateBatch {
+                if constexpr (std::derived_from<T, Node>)
+                    return { updateBatch<T>, !std::same_as<decltype(&T::update), decltype(&Node::update)> };
+                else
+                    return {};
+            }(),
+            [] {
+                if constexpr (std::derived_from<T, Node>)
+                    return !std::same_as<decltype(&T::input), decltype(&Node::input)>;
+                else
+                    return false;
+            }()
+        };
+    }
+
+    template <typename... Ts>
+    consteval auto Registry::makeTypeTable() noexcept {
+        std::array<NamedEntry, sizeof...(Ts)> table { NamedEntry{ Ts::getClassStatic(), makeEntry<Ts>() }... };
+        std::ranges::sort(table, {}, &NamedEntry::name);
+        return table;
+    }
+
+    constexpr const Registry::Entry* Registry::findEntry(const std::string_view className) noexcept {
+        const auto it = std::ranges::lower_bound(mTypeTable, className, {}, &NamedEntry::name);
+        if (it != mTypeTable.end() && it->name == className)
+            return &it->entry;
+
+        if (const auto registered = mRegistry.find(className); registered != mRegistry.end())
+            return &registered->second;
+
+        return {};
+    }
+
     template <typename T>
     requires (!std::derived_from<T, Resource>)
     constexpr void Registry::registerType() {
-        mRegistry.emplace(
-            T::getClassStatic(),
-            Entry {
-                [] -> std::unique_ptr<Object> {
-                    if constexpr (std::is_default_constructible_v<T>)
-                        return std::make_unique<T>();
-                    else
-                        return {};
-                },
-                T::getMemberStatic,
-                T::getMethodStatic
-            }
-        );
+        mRegistry.emplace(T::getClassStatic(), makeEntry<T>());
+    }
+
+    template <typename T>
+    void Registry::updateBatch(const std::span<Node* const> nodes, const Seconds<float> delta) {
+        for (Node* node : nodes) {
+            if (!node)
+                continue;
+
+            static_cast<T*>(node)->T::update(delta);
+            if (BaseScript* script = node->getScript())
+                script->update(delta);
+        }
     }
 
     template <typename ... Ts>
@@ -94,28 +184,40 @@ namespace M3DS {
         (registerType<Ts>(), ...);
     }
 
+    template <typename... Ts>
+    requires (!std::derived_from<Ts, Resource> &&...)
+    constexpr void Registry::registerTypePack(TypePack<Ts...>) noexcept {
+        static constexpr auto table = makeTypeTable<Ts...>();
+        mTypeTable = table;
+    }
+
     constexpr std::unique_ptr<Object> Registry::instantiate(std::string_view className) {
-        if (const auto it = mRegistry.find(className); it != mRegistry.end()) {
-            return it->second.uniqueInstantiator();
-        }
+        if (const Entry* entry = findEntry(className))
+            return entry->uniqueInstantiator();
+        return {};
+    }
+
+    constexpr std::optional<Registry::UpdateBatch> Registry::getUpdateBatch(const std::string_view className) {
+        if (const Entry* entry = findEntry(className); entry && entry->updateBatch.func)
+            return entry->updateBatch;
         return {};
     }
 
+    constexpr bool Registry::overridesInput(const std::string_view className) {
+        if (const Entry* entry = findEntry(className))
+            return entry->overridesInput;
+        return true;
+    }
+
     constexpr const GenericMember* Registry::getMember(const std::string_view className, const std::string_view memberName) {
-        if (const auto it = mRegistry.find(className); it != mRegistry.end()) {
-            if (const auto& func = it->second.getMembersFunc) {
-                return func(memberName);
-            }
-        }
+        if (const Entry* entry = findEntry(className); entry && entry->getMembersFunc)
+            return entry->getMembersFunc(memberName);
         return {};
     }
 
     constexpr BoundMethodPair Registry::getMethodPair(const std::string_view className, const std::string_view methodName) {
-        if (const auto it = mRegistry.find(className); it != mRegistry.end()) {
-            if (const auto& func = it->second.getMethodFunc) {
-                return func(methodName);
-            }
-        }
+        if (const Entry* entry = findEntry(className); entry && entry->getMethodFunc)
+            return entry->getMethodFunc(methodName);
         return {};
     }
 
@@ -115,6 +115,11 @@ namespace M3DS {
         Node2D::draw(target);
     }
 
+    // Particles only draw directly, so trees containing them are never pipelined.
+    bool Particles2D::isRecordable() const noexcept {
+        return false;
+    }
+
     Particles2D::Particle2D Particles2D::createParticle() noexcept {
         return {
             { .scale = particleMaterial->scale(mRandom) },
@@ -1,5 +1,7 @@
 #include <m3ds/nodes/2d/Sprite2D.hpp>
 
+#include <m3ds/render/RenderSnapshot.hpp>
+
 namespace M3DS {
     Sprite2D::Sprite2D(SpriteSheet sheet) noexcept
         : spritesheet(std::move(sheet))
@@ -48,6 +50,20 @@ namespace M3DS {
         Node2D::draw(target);
     }
 
+    void Sprite2D::record(RenderSnapshot& snapshot) const {
+        if (spritesheet) {
+            snapshot.addSprite(
+                spritesheet,
+                getGlobalTransform(),
+                frame % spritesheet.getFrameCount(),
+                centre,
+                getCanvasLayer() != nullptr
+            );
+        }
+
+        Node2D::record(snapshot);
+    }
+
     REGISTER_NO_METHODS(Sprite2D);
 
     REGISTER_MEMBERS(
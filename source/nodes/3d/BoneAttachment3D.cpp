@@ -27,6 +27,7 @@ namespace M3DS {
     }
 
     void BoneAttachment3D::afterTreeEnter() {
+        Node3D::afterTreeEnter();
         mMeshInstance = object_cast<MeshInstance*>(getParent());
     }
 
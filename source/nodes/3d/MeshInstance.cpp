@@ -1,5 +1,8 @@
 #include <m3ds/nodes/3d/MeshInstance.hpp>
 
+#include <m3ds/nodes/Root.hpp>
+#include <m3ds/render/RenderSnapshot.hpp>
+
 namespace M3DS {
     MeshInstance::MeshInstance(std::shared_ptr<const Mesh> mesh) noexcept {
         setMesh(std::move(mesh));
@@ -51,6 +54,13 @@ namespace M3DS {
         target.render(*this);
     }
 
+    void MeshInstance::record(RenderSnapshot& snapshot) const {
+        Node3D::record(snapshot);
+
+        if (mMesh)
+            snapshot.addMesh(mMesh, getGlobalTransform(), getBones());
+    }
+
     void MeshInstance::playAnimation(const std::string_view animation) noexcept {
         playAnimationPtr(getAnimation(animation));
     }
@@ -201,6 +211,7 @@ namespace M3DS {
                 mMesh = std::move(exp.value());
             else
                 return exp.error();
+            deserialiser.retain(mMesh);
 
             // TODO: Deserialise current animation state?
         }
@@ -252,13 +263,23 @@ namespace M3DS {
 
 
 
-    void MeshInstance::update(const Seconds<float> delta) {
-        Node3D::update(delta);
-        if (!mMesh)
-            return;
+    void MeshInstance::afterTreeEnter() {
+        Node3D::afterTreeEnter();
 
-        updateProgress(delta);
+        getRoot()->addMeshInstance(this);
+    }
+
+    void MeshInstance::beforeTreeExit() {
+        Node3D::beforeTreeExit();
+
+        getRoot()->removeMeshInstance(this);
+    }
+
+    bool MeshInstance::isAnimationDue() const noexcept {
+        return mMesh && !mBones.empty() && mAnimationData.primaryState.animation && isProcessing();
+    }
 
+    void MeshInstance::updatePose() noexcept {
         if (mAnimationData.blend > 0) {
             for (const std::uint16_t& i : mMesh->getBoneUpdateOrder())
                 updateBone<true>(i);
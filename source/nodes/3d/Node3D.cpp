@@ -1,28 +1,30 @@
 #include <m3ds/nodes/3d/Node3D.hpp>
 
+#include <m3ds/nodes/Root.hpp>
+
 namespace M3DS {
     void Node3D::setTransform(const Matrix4x4& to) noexcept {
         if (to != mTransform) {
-            setGlobalTransformDirty();
             mTransform = to;
+            transformChanged();
         }
     }
 
     void Node3D::setTranslation(const Vector3& to) noexcept {
         if (mTransform.getTranslation() != to) {
             mTransform.setTranslation(to);
-            setGlobalTransformDirty();
+            transformChanged();
         }
     }
 
     void Node3D::setRotation([[maybe_unused]] const Quaternion& to) noexcept {
         mTransform.setRotation(to);
-        setGlobalTransformDirty();
+        transformChanged();
     }
 
     void Node3D::setScale([[maybe_unused]] const Vector3& to) noexcept {
         mTransform.setScale(to);
-        setGlobalTransformDirty();
+        transformChanged();
     }
 
     const Matrix4x4& Node3D::getTransform() const noexcept {
@@ -30,13 +32,13 @@ namespace M3DS {
     }
 
     const Matrix4x4& Node3D::getGlobalTransform() const noexcept {
-        if (mGlobalTransformDirty) {
-            if (const auto* parentItem = object_cast<const Node3D*>(getParent())) {
-                mGlobalTransform = parentItem->getGlobalTransform() * mTransform;
-            } else {
-                mGlobalTransform = mTransform;
-            }
-            mGlobalTransformDirty = false;
+        if (mTransformIndex != TransformHierarchy3D::noIndex)
+            return getRoot()->mTransforms3D.getGlobal(mTransformIndex);
+
+        if (const auto* parentItem = object_cast<const Node3D*>(getParent())) {
+            mGlobalTransform = parentItem->getGlobalTransform() * mTransform;
+        } else {
+            mGlobalTransform = mTransform;
         }
         return mGlobalTransform;
     }
@@ -102,20 +104,39 @@ namespace M3DS {
         if (!deserialiser.read(mTransform))
             return Failure{ ErrorCode::file_read_fail };
 
-        mGlobalTransformDirty = true;
+        transformChanged();
 
         return Success;
     }
 
-    void Node3D::setGlobalTransformDirty() noexcept {
-        if (!mGlobalTransformDirty) {
-            mGlobalTransformDirty = true;
-            for (auto& child : getChildren()) {
-                if (auto* c = object_cast<Node3D*>(child.get())) {
-                    c->setGlobalTransformDirty();
-                }
-            }
+    void Node3D::afterTreeEnter() {
+        Node::afterTreeEnter();
+
+        Root* root = getRoot();
+        if (!root)
+            return;
+
+        TransformHierarchy3D::Index parentIndex = TransformHierarchy3D::noIndex;
+        if (const auto* parent = object_cast<const Node3D*>(getParent())) {
+            // Stay out of the hierarchy along with the parent, so the global transform still follows it.
+            if (parent->mTransformIndex == TransformHierarchy3D::noIndex)
+                return;
+            parentIndex = parent->mTransformIndex;
         }
+
+        root->mTransforms3D.add(parentIndex, mTransform, &mTransformIndex);
+    }
+
+    void Node3D::beforeTreeExit() {
+        Node::beforeTreeExit();
+
+        if (Root* root = getRoot(); root && mTransformIndex != TransformHierarchy3D::noIndex)
+            root->mTransforms3D.remove(mTransformIndex);
+    }
+
+    void Node3D::transformChanged() noexcept {
+        if (mTransformIndex != TransformHierarchy3D::noIndex)
+            getRoot()->mTransforms3D.setLocal(mTransformIndex, mTransform);
     }
 
     REGISTER_METHODS(
@@ -1,5 +1,7 @@
 #include <m3ds/nodes/3d/Sprite3D.hpp>
 
+#include <m3ds/render/RenderSnapshot.hpp>
+
 namespace M3DS {
     Sprite3D::Sprite3D(SpriteSheet sheet) noexcept
         : spritesheet(std::move(sheet))
@@ -24,6 +26,21 @@ namespace M3DS {
         Node3D::draw(target);
     }
 
+    void Sprite3D::record(RenderSnapshot& snapshot) const {
+        if (spritesheet) {
+            snapshot.addSprite(
+                spritesheet,
+                getGlobalTransform(),
+                frame % spritesheet.getFrameCount(),
+                pixelSize,
+                cullBack,
+                billboard
+            );
+        }
+
+        Node3D::record(snapshot);
+    }
+
     Failure Sprite3D::serialise(Serialiser& serialiser) const noexcept {
         if (const Failure failure = SuperType::serialise(serialiser))
             return failure;
@@ -285,12 +285,18 @@ namespace M3DS {
                 continue;
 
             const Animation* animation = layer.animation;
+            const auto animationEntries = animation->getEntries();
 
-            for (auto&& [path, entries] : animation->getEntries()) {
+            // Entries are only ever appended, so only new ones need compiling.
+            for (std::size_t i = layer.paths.size(); i < animationEntries.size(); ++i)
+                layer.paths.emplace_back(animationEntries[i].path);
+
+            for (std::size_t i{}; i < animationEntries.size(); ++i) {
+                auto&& [path, entries] = animationEntries[i];
                 if (entries.empty())
                     continue;
 
-                Node* node = getNode(path);
+                Node* node = getNode(layer.paths[i]);
 
                 if (!node)
                     Debug::err("Invalid animation NodePath: {}", path);
@@ -1,5 +1,6 @@
 #include <m3ds/nodes/CanvasItem.hpp>
 
+#include <m3ds/nodes/Root.hpp>
 #include <m3ds/nodes/Viewport.hpp>
 #include <m3ds/nodes/2d/Camera2D.hpp>
 
@@ -7,7 +8,7 @@ namespace M3DS {
     void CanvasItem::setTranslation(const Vector2& to) noexcept {
         if (mTransform.position != to) {
             mTransform.position = to;
-            setGlobalTransformDirty();
+            transformChanged();
         }
     }
 
@@ -18,7 +19,7 @@ namespace M3DS {
     void CanvasItem::setRotation(const Radians<float> to) noexcept {
         if (mTransform.rotation != to) {
             mTransform.rotation = to;
-            setGlobalTransformDirty();
+            transformChanged();
         }
     }
 
@@ -29,7 +30,7 @@ namespace M3DS {
     void CanvasItem::setScale(const Vector2& to) noexcept {
         if (mTransform.scale != to) {
             mTransform.scale = to;
-            setGlobalTransformDirty();
+            transformChanged();
         }
     }
 
@@ -38,13 +39,13 @@ namespace M3DS {
     }
 
     const Transform2D& CanvasItem::getGlobalTransform() const noexcept {
-        if (mGlobalTransformDirty) {
-            if (const auto* parentItem = object_cast<const CanvasItem*>(getParent())) {
-                mGlobalTransform = parentItem->getGlobalTransform().offset(mTransform);
-            } else {
-                mGlobalTransform = mTransform;
-            }
-            mGlobalTransformDirty = false;
+        if (mTransformIndex != TransformHierarchy2D::noIndex)
+            return getRoot()->mTransforms2D.getGlobal(mTransformIndex);
+
+        if (const auto* parentItem = object_cast<const CanvasItem*>(getParent())) {
+            mGlobalTransform = parentItem->getGlobalTransform().offset(mTransform);
+        } else {
+            mGlobalTransform = mTransform;
         }
         return mGlobalTransform;
     }
@@ -91,30 +92,39 @@ namespace M3DS {
         if (!deserialiser.read(mTransform))
             return Failure{ ErrorCode::file_read_fail };
 
+        transformChanged();
+
         return Success;
     }
 
     void CanvasItem::afterTreeEnter() {
         Node::afterTreeEnter();
 
-        mGlobalTransformDirty = true;
+        Root* root = getRoot();
+        if (!root)
+            return;
+
+        TransformHierarchy2D::Index parentIndex = TransformHierarchy2D::noIndex;
+        if (const auto* parent = object_cast<const CanvasItem*>(getParent())) {
+            // Stay out of the hierarchy along with the parent, so the global transform still follows it.
+            if (parent->mTransformIndex == TransformHierarchy2D::noIndex)
+                return;
+            parentIndex = parent->mTransformIndex;
+        }
+
+        root->mTransforms2D.add(parentIndex, mTransform, &mTransformIndex);
     }
 
     void CanvasItem::beforeTreeExit() {
         Node::beforeTreeExit();
 
-        mGlobalTransformDirty = true;
+        if (Root* root = getRoot(); root && mTransformIndex != TransformHierarchy2D::noIndex)
+            root->mTransforms2D.remove(mTransformIndex);
     }
 
-    void CanvasItem::setGlobalTransformDirty() noexcept {
-        if (!mGlobalTransformDirty) {
-            mGlobalTransformDirty = true;
-            for (auto& child : getChildren()) {
-                if (auto* c = object_cast<CanvasItem*>(child.get())) {
-                    c->setGlobalTransformDirty();
-                }
-            }
-        }
+    void CanvasItem::transformChanged() noexcept {
+        if (mTransformIndex != TransformHierarchy2D::noIndex)
+            getRoot()->mTransforms2D.setLocal(mTransformIndex, mTransform);
     }
 
     REGISTER_METHODS(
@@ -1,7 +1,5 @@
 #include <m3ds/nodes/Node.hpp>
 
-#include <stack>
-
 #include <m3ds/nodes/Root.hpp>
 
 #include <m3ds/utils/binding/Registry.hpp>
@@ -23,6 +21,11 @@ namespace M3DS {
         CONST_METHOD(getCanvasLayer),
         MUTABLE_METHOD(setName),
         CONST_METHOD(isHelper),
+        CONST_METHOD(isProcessing),
+        MUTABLE_METHOD(setProcessPriority),
+        CONST_METHOD(getProcessPriority),
+        MUTABLE_METHOD(setUpdateInterval),
+        CONST_METHOD(getUpdateInterval),
         BOTH_METHOD(getScript),
         BOTH_METHOD(getNode),
         BOTH_METHOD(getChild),
@@ -42,11 +45,38 @@ namespace M3DS {
         return mChildren;
     }
 
+    void* Node::operator new(const std::size_t size) {
+        void* ptr = NodePool::allocate(size);
+        if (!ptr)
+            Debug::terminate("NodePool failed to allocate {} bytes!", size);
+        return ptr;
+    }
+
+    void* Node::operator new(const std::size_t size, const std::nothrow_t&) noexcept {
+        return NodePool::allocate(size);
+    }
+
+    void Node::operator delete(void* ptr, const std::size_t size) noexcept {
+        NodePool::deallocate(ptr, size);
+    }
+
+    void* Node::operator new(const std::size_t size, const std::align_val_t alignment) {
+        return ::operator new(size, alignment);
+    }
+
+    void* Node::operator new(const std::size_t size, const std::align_val_t alignment, const std::nothrow_t&) noexcept {
+        return ::operator new(size, alignment, std::nothrow);
+    }
+
+    void Node::operator delete(void* ptr, const std::size_t size, const std::align_val_t alignment) noexcept {
+        ::operator delete(ptr, size, alignment);
+    }
+
     Node::~Node() noexcept {
-        if (mRoot)
-            mRoot->disableUpdate(this);
-        for (auto* signal : mIncomingConnections | std::views::keys)
-            erase_if(signal->mConnections, [this](const auto& pair) { return pair.first == this; });
+        if (mRoot && mRoot != this)
+            leaveRoot();
+        if (mHandleIndex != NodeHandle::noIndex)
+            NodeHandle::release(mHandleIndex);
     }
 
     Node* Node::getParent() noexcept {
@@ -69,20 +99,121 @@ namespace M3DS {
         return getRoot() != nullptr;
     }
 
+    NodeHandle Node::getHandle() {
+        if (mHandleIndex == NodeHandle::noIndex)
+            mHandleIndex = NodeHandle::acquire(this);
+        return NodeHandle::fromIndex(mHandleIndex);
+    }
+
     void Node::setName(const std::string_view name) {
-        mName = name;
+        const NodeName oldName = mName;
+        mName = NodeName{ name.empty() ? getClass() : name };
+
+        if (oldName != mName)
+            touchSubtree();
+
+        if (mParent && mParent->mChildIndex && oldName != mName) {
+            mParent->unindexChild(this, oldName);
+            mParent->indexChild(this);
+
+            // Unlike an appended child, a renamed one may come before the first sibling it now shares a name with.
+            if ((*mParent->mChildIndex)[mName].count > 1)
+                mParent->refreshChildIndexEntry(mName);
+        }
     }
 
     std::string_view Node::getName() const noexcept {
-        if (mName.empty())
+        if (!mName)
             return getClass();
+        return mName.view();
+    }
+
+    NodeName Node::getNodeName() const noexcept {
         return mName;
     }
 
+    void Node::touchSubtree() noexcept {
+        const std::uint32_t generation = ++mTreeGeneration;
+        for (Node* node = this; node; node = node->mParent)
+            node->mSubtreeGeneration = generation;
+    }
+
+    void Node::linkChild(Node* child) {
+        touchSubtree();
+
+        child->mParent = this;
+        if (!child->mName)
+            child->mName = NodeName{ child->getClass() };
+
+        indexChild(child);
+    }
+
+    void Node::indexChild(Node* child) {
+        if (!mChildIndex) {
+            if (mChildren.size() <= childIndexThreshold)
+                return;
+
+            mChildIndex = std::make_unique<std::unordered_map<NodeName, ChildIndexEntry>>();
+            for (const std::unique_ptr<Node>& node : mChildren) {
+                ChildIndexEntry& entry = (*mChildIndex)[node->mName];
+                if (!entry.first)
+                    entry.first = node.get();
+                ++entry.count;
+            }
+            return;
+        }
+
+        // An appended child never comes before a sibling of the same name, so spawning many same-named
+        // children stays constant time.
+        ChildIndexEntry& entry = (*mChildIndex)[child->mName];
+        ++entry.count;
+        if (!entry.first)
+            entry.first = child;
+    }
+
+    void Node::unindexChild(const Node* child, const NodeName name) {
+        if (!mChildIndex)
+            return;
+
+        const auto it = mChildIndex->find(name);
+        if (it == mChildIndex->end())
+            return;
+
+        if (--it->second.count == 0)
+            mChildIndex->erase(it);
+        else if (it->second.first == child)
+            refreshChildIndexEntry(name);
+    }
+
+    void Node::refreshChildIndexEntry(const NodeName name) {
+        // Only reached when siblings share a name, keeping the first of them as getNode() would find it linearly.
+        ChildIndexEntry& entry = (*mChildIndex)[name];
+        const auto it = std::ranges::find(mChildren, name, [](const std::unique_ptr<Node>& node) {
+            return node->mName;
+        });
+        entry.first = it != mChildren.end() ? it->get() : nullptr;
+    }
+
+    Node* Node::findChild(const NodeName name) const noexcept {
+        if (!name)
+            return {};
+
+        if (mChildIndex) {
+            const auto it = mChildIndex->find(name);
+            return it != mChildIndex->end() ? it->second.first : nullptr;
+        }
+
+        for (const std::unique_ptr<Node>& child : mChildren) {
+            if (child->mName == name)
+                return child.get();
+        }
+        return {};
+    }
+
     Node* Node::emplaceChild(std::unique_ptr<Node> node) {
         Node* child = mChildren.emplace_back(std::move(node)).get();
 
-        child->mParent = this;
+        linkChild(child);
         if (isInTree())
             child->propagateNotification(Notification::tree_entered);
 
@@ -107,6 +238,15 @@ namespace M3DS {
             child->draw(target);
     }
 
+    void Node::record(RenderSnapshot& snapshot) const {
+        for (const std::unique_ptr<Node>& child : mChildren)
+            child->record(snapshot);
+    }
+
+    bool Node::isRecordable() const noexcept {
+        return !mScriptDraws;
+    }
+
     void Node::input([[maybe_unused]] Input::InputFrame& inputFrame) {}
 
     void Node::notification(const Notification notification) {
@@ -117,8 +257,9 @@ namespace M3DS {
                     mViewport = parent->mViewport;
 
                 mRoot = parent->mRoot;
+                mProcessState = resolveProcessState(getProcessMode(), parent->mProcessState);
                 if (mRoot)
-                    mRoot->enableUpdate(this);
+                    joinRoot();
             }
 
             afterTreeEnter();
@@ -132,12 +273,69 @@ namespace M3DS {
                 mCanvasLayer = {};
 
             if (mRoot) {
-                mRoot->disableUpdate(this);
+                leaveRoot();
                 mRoot = {};
             }
         }
     }
 
+    void Node::joinRoot() {
+        mRoot->enableUpdate(this);
+        if (handlesInput())
+            mRoot->addInputListener(this);
+
+        if (!isRecordable())
+            ++mRoot->mUnrecordableNodes;
+
+        mRoot->addInstance(this);
+        for (GroupMembership& membership : getGroups())
+            mRoot->joinGroup(this, membership);
+    }
+
+    void Node::leaveRoot() noexcept {
+        mRoot->disableUpdate(this);
+        if (mCoroutines)
+            mRoot->getCoroutineScheduler().cancel(this);
+        if (mInputListener)
+            mRoot->removeInputListener(this);
+
+        if (!isRecordable())
+            --mRoot->mUnrecordableNodes;
+
+        mRoot->removeInstance(this);
+        for (const GroupMembership& membership : getGroups())
+            mRoot->leaveGroup(this, membership);
+    }
+
+    void Node::addToGroup(const std::string_view group) {
+        if (isInGroup(group))
+            return;
+
+        GroupMembership& membership = getCold().groups.emplace_back(NodeName{ group });
+        if (mRoot)
+            mRoot->joinGroup(this, membership);
+    }
+
+    void Node::removeFromGroup(const std::string_view group) {
+        const NodeName name = NodeName::find(group);
+        if (!name || !mCold)
+            return;
+
+        std::vector<GroupMembership>& groups = mCold->groups;
+        const auto it = std::ranges::find(groups, name, &GroupMembership::group);
+        if (it == groups.end())
+            return;
+
+        if (mRoot)
+            mRoot->leaveGroup(this, *it);
+        groups.erase(it);
+    }
+
+    bool Node::isInGroup(const std::string_view group) const noexcept {
+        const NodeName name = NodeName::find(group);
+        return name && mCold && std::ranges::contains(mCold->groups, name, &GroupMembership::group);
+    }
+
     void Node::afterTreeEnter() {}
     void Node::beforeTreeExit() {}
 
@@ -152,11 +350,45 @@ namespace M3DS {
             return false;
         });
 
+        if (!ret)
+            return ret;
+
+        touchSubtree();
+        unindexChild(ret.get(), ret->mName);
+        if (mChildIndex && mChildren.size() <= childIndexThreshold / 2)
+            mChildIndex.reset();
+
+        if (mRoot)
+            mRoot->disableUpdateSubtree(ret.get());
         ret->propagateNotification(Notification::tree_exited);
 
         return ret;
     }
 
+    void Node::detachFreeingChildren(std::vector<std::unique_ptr<Node>>& detached) {
+        const std::size_t firstDetached = detached.size();
+
+        std::size_t kept {};
+        for (std::size_t i{}; i < mChildren.size(); ++i) {
+            if (mChildren[i]->mFreeing) {
+                detached.emplace_back(std::move(mChildren[i]));
+                continue;
+            }
+            if (i != kept)
+                mChildren[kept] = std::move(mChildren[i]);
+            ++kept;
+        }
+        mChildren.resize(kept);
+
+        // Unindexed once mChildren is compacted, as refreshing an entry searches it.
+        for (const auto& child : std::span{detached}.subspan(firstDetached))
+            unindexChild(child.get(), child->mName);
+
+        touchSubtree();
+        if (mChildIndex && mChildren.size() <= childIndexThreshold / 2)
+            mChildIndex.reset();
+    }
+
     std::unique_ptr<Node> Node::removeChild(const std::size_t idx) noexcept {
         if (idx < mChildren.size())
             return removeChild(mChildren[idx].get());
@@ -167,6 +399,120 @@ namespace M3DS {
         return mHelper;
     }
 
+    void Node::setProcessMode(const ProcessMode mode) {
+        if (mode == getProcessMode())
+            return;
+
+        getCold().processMode = mode;
+        refreshProcessState();
+    }
+
+    Node::ProcessMode Node::getProcessMode() const noexcept {
+        return mCold ? mCold->processMode : ProcessMode::inherit;
+    }
+
+    bool Node::isProcessing() const noexcept {
+        return mProcessState == ProcessState::active;
+    }
+
+    void Node::setProcessPriority(const int priority) {
+        if (priority == getProcessPriority())
+            return;
+
+        getCold().processPriority = priority;
+        refreshUpdateBucket();
+    }
+
+    int Node::getProcessPriority() const noexcept {
+        return mCold ? mCold->processPriority : 0;
+    }
+
+    void Node::setUpdateRate(const UpdateRate rate) {
+        if (rate == getUpdateRate())
+            return;
+
+        getCold().updateRate = rate;
+        refreshUpdateBucket();
+    }
+
+    Node::UpdateRate Node::getUpdateRate() const noexcept {
+        return mCold ? mCold->updateRate : UpdateRate::interval;
+    }
+
+    void Node::setUpdateInterval(std::uint8_t frames) {
+        frames = std::max<std::uint8_t>(frames, 1);
+        if (frames == getUpdateInterval())
+            return;
+
+        getCold().updateInterval = frames;
+        if (getUpdateRate() == UpdateRate::interval)
+            refreshUpdateBucket();
+    }
+
+    std::uint8_t Node::getUpdateInterval() const noexcept {
+        return mCold ? mCold->updateInterval : 1;
+    }
+
+    void Node::refreshUpdateBucket() {
+        if (mRoot && mUpdateSlot != noUpdateSlot) {
+            mRoot->disableUpdate(this);
+            mRoot->enableUpdate(this);
+        }
+    }
+
+    Node::ColdData& Node::getCold() {
+        if (!mCold)
+            mCold = std::make_unique<ColdData>();
+        return *mCold;
+    }
+
+    std::span<Node::GroupMembership> Node::getGroups() noexcept {
+        if (mCold)
+            return mCold->groups;
+        return {};
+    }
+
+    void Node::refreshProcessState() {
+        if (!mRoot)
+            return;
+
+        auto nodes = walk<TreeOrder::preorder>();
+        for (Node& curr : nodes) {
+            const ProcessState parentState = curr.mParent ? curr.mParent->mProcessState : ProcessState::active;
+            const ProcessState state = resolveProcessState(curr.getProcessMode(), parentState);
+
+            // Descendants only depend on their parent's state, so unchanged subtrees can be skipped.
+            if (&curr != this && state == curr.mProcessState) {
+                nodes.skipChildren();
+                continue;
+            }
+
+            const bool wasActive = curr.mProcessState == ProcessState::active;
+            curr.mProcessState = state;
+            if (state == ProcessState::active)
+                mRoot->enableUpdate(&curr);
+            else
+                mRoot->disableUpdate(&curr);
+
+            if (wasActive != (state == ProcessState::active))
+                curr.notification(wasActive ? Notification::paused : Notification::unpaused);
+        }
+    }
+
+    Node::ProcessState Node::resolveProcessState(const ProcessMode mode, const ProcessState parentState) noexcept {
+        switch (mode) {
+            case ProcessMode::inherit:
+                return parentState;
+            case ProcessMode::always:
+                return parentState == ProcessState::disabled ? ProcessState::disabled : ProcessState::active;
+            case ProcessMode::paused:
+                return parentState == ProcessState::disabled ? ProcessState::disabled : ProcessState::paused;
+            case ProcessMode::disabled:
+                return ProcessState::disabled;
+        }
+        return parentState;
+    }
+
     BaseScript* Node::getScript() noexcept {
         return mScript.get();
     }
@@ -176,7 +522,11 @@ namespace M3DS {
     }
 
     Node* Node::getNode(const NodePath& path) noexcept {
-        auto curr = this;
+        return const_cast<Node*>(std::as_const(*this).getNode(path));
+    }
+
+    const Node* Node::getNode(const NodePath& path) const noexcept {
+        const Node* curr = this;
         for (const auto& node : path) {
             if (node == ".")
                 continue;
@@ -184,41 +534,56 @@ namespace M3DS {
                 curr = curr->mParent;
                 continue;
             }
-            const auto it = std::ranges::find_if(
-                curr->mChildren,
-                [&node](const std::unique_ptr<Node>& child) {
-                    return child->getName() == node;
-                }
-            );
-            if (it == curr->mChildren.end())
+            // A name that was never interned cannot belong to any node.
+            curr = curr->findChild(NodeName::find(node));
+            if (!curr)
                 return {};
-            curr = it->get();
         }
         return curr;
     }
 
-    const Node* Node::getNode(const NodePath& path) const noexcept {
-        auto curr = this;
-        for (const auto& node : path) {
-            if (node == ".")
-                continue;
-            if (node == "..") {
-                curr = curr->mParent;
-                continue;
-            }
-            const auto it = std::ranges::find_if(
-                curr->mChildren,
-                [&node](const std::unique_ptr<Node>& child) {
-                    return child->mName == node;
-                }
-            );
-            if (it == curr->mChildren.end())
-                return {};
-            curr = it->get();
+    Node* Node::getNode(const CompiledNodePath& path) noexcept {
+        return const_cast<Node*>(std::as_const(*this).getNode(path));
+    }
+
+    const Node* Node::getNode(const CompiledNodePath& path) const noexcept {
+        if (path.mUnresolvable)
+            return nullptr;
+
+        const Node* base = this;
+        for (std::size_t i{}; base && i < path.mParentHops; ++i)
+            base = base->mParent;
+
+        // Everything the walk can reach lies under the anchor, so a cached result stands while its stamp does.
+        const Node* anchor = base;
+        for (std::size_t i{}; anchor && i < path.mAnchorHops; ++i)
+            anchor = anchor->mParent;
+
+        CompiledNodePath::Cache& cache = path.mCache;
+        const bool cacheable = path.mCached && anchor;
+        if (
+            cacheable && cache.valid && cache.from == this &&
+            cache.anchor == anchor && cache.generation == anchor->mSubtreeGeneration
+        )
+            return cache.node;
+
+        const Node* curr = base;
+        for (const NodeName name : path.mSegments) {
+            if (!curr)
+                break;
+            curr = name ? curr->findChild(name) : curr->mParent;
         }
+
+        if (cacheable)
+            cache = { this, anchor, curr, anchor->mSubtreeGeneration, true };
+
         return curr;
     }
 
+    std::uint32_t Node::getTreeGeneration() noexcept {
+        return mTreeGeneration;
+    }
+
     Node* Node::getChild(const std::size_t idx) noexcept {
         return mChildren[idx].get();
     }
@@ -232,21 +597,20 @@ namespace M3DS {
     }
 
     NodePath Node::getPath() const {
-        std::stack<const Node*> stack {};
         std::size_t characters {};
-        for (auto curr = this; curr; curr = curr->mParent) {
-            stack.emplace(curr);
-            characters += curr->mName.size() + 1;
-        }
+        for (auto curr = this; curr; curr = curr->mParent)
+            characters += curr->getName().size() + 1;
 
-        NodePath path { std::string{stack.top()->getName()} };
-        path.reserve(characters);
-        stack.pop();
-        while (!stack.empty()) {
-            path /= stack.top()->getName();
-            stack.pop();
+        // Filled from the end, walking up from this node.
+        std::string path(characters - 1, '/');
+        std::size_t end = path.size();
+        for (auto curr = this; curr; curr = curr->mParent) {
+            const std::string_view name = curr->getName();
+            end -= name.size();
+            name.copy(path.data() + end, name.size());
+            --end;
         }
-        return path;
+        return NodePath{ std::move(path) };
     }
 
     std::size_t getDepth(const Node* node) noexcept {
@@ -303,7 +667,7 @@ namespace M3DS {
         [&](this const auto& self, const Node* curr) -> void {
             if (curr != commonAncestor) {
                 self(curr->mParent);
-                path += curr->mName;
+                path += curr->getName();
                 path += '/';
             }
         }(other);
@@ -314,21 +678,22 @@ namespace M3DS {
     }
 
     void Node::printTree() const noexcept {
-        std::stack<std::pair<const Node*, int>> stack {};
-        stack.emplace(this, 0);
-
-        while (!stack.empty()) {
-            const auto [curr, depth] = stack.top();
-            stack.pop();
-
-            for (int i = 0; i < depth; ++i)
+        for (const Node& curr : walk<TreeOrder::preorder>()) {
+            for (const Node* ancestor = &curr; ancestor != this; ancestor = ancestor->mParent)
                 std::cout << "  ";
-            std::cout << curr->getName() << std::endl;
-            for (const auto& child : curr->mChildren | std::views::reverse)
-                stack.emplace(child.get(), depth + 1);
+            std::cout << curr.getName() << std::endl;
         }
     }
 
+    bool Node::handlesInput() const noexcept {
+        // The class entry only describes nodes of exactly that class.
+        return mScriptHandlesInput || !mExactClass || Registry::overridesInput(getClass());
+    }
+
+    TreeScratch& Node::getWalkScratch() const noexcept {
+        return mRoot ? mRoot->mWalkScratch : mDetachedScratch;
+    }
+
     void Node::queueFree() {
         if (Root* root = getRoot())
             root->addToFreeQueue(this);
@@ -336,6 +701,29 @@ namespace M3DS {
             free();
     }
 
+    CallQueue* Node::getCallQueue() noexcept {
+        return mRoot ? &mRoot->getCallQueue() : nullptr;
+    }
+
+    CoroutineId Node::startCoroutine(Coroutine coroutine) {
+        if (!mRoot)
+            return {};
+        return mRoot->getCoroutineScheduler().start(*this, std::move(coroutine));
+    }
+
+    void Node::stopCoroutine(const CoroutineId id) noexcept {
+        if (mRoot)
+            mRoot->getCoroutineScheduler().stop(id);
+    }
+
+    TimerWheel* Node::getTimerWheel() noexcept {
+        return mRoot ? &mRoot->getTimerWheel() : nullptr;
+    }
+
+    const TimerWheel* Node::getTimerWheel() const noexcept {
+        return mRoot ? &mRoot->getTimerWheel() : nullptr;
+    }
+
     void Node::free() {
         if (Node* parent = getParent())
             std::ignore = parent->removeChild(this);
@@ -346,7 +734,7 @@ namespace M3DS {
         if (const Failure failure = Object::serialise(serialiser))
             return failure;
 
-        const std::string_view name = mName == getClass() ? std::string_view{} : mName;
+        const std::string_view name = getName() == getClass() ? std::string_view{} : getName();
 
         if (name.size() > 1024)
             return Failure{ ErrorCode::invalid_data };
@@ -400,9 +788,11 @@ namespace M3DS {
         if (nameLength > 1024)
             return Failure{ ErrorCode::invalid_data };
 
-        mName.resize(nameLength);
-        if (!deserialiser.read(std::span{mName}))
+        std::string name {};
+        name.resize(nameLength);
+        if (!deserialiser.read(std::span{name}))
             return Failure{ ErrorCode::file_read_fail };
+        setName(name);
 
         std::uint16_t childCount;
         if (!deserialiser.read(childCount))
@@ -1,15 +1,26 @@
 #include <m3ds/nodes/Root.hpp>
 
-#include <stack>
+#include <algorithm>
+#include <iterator>
+#include <ranges>
 
 #include <m3ds/nodes/Viewport.hpp>
+#include <m3ds/nodes/3d/MeshInstance.hpp>
 
 namespace M3DS {
     Root::Root() noexcept {
-        mName = "Root";
+        mName = NodeName{ "Root" };
         mRoot = this;
     }
 
+    Root::~Root() noexcept {
+        // Children leave the tree through this Root's members, so they are destroyed before ~Node,
+        // while those are still alive.
+        std::vector<std::unique_ptr<Node>> children = std::move(mChildren);
+        mChildIndex.reset();
+        children.clear();
+    }
+
     void Root::treeInput() noexcept {
         std::array<Input::InputFrame, 8> inputFrames;
         std::size_t inputFrameCount {};
@@ -21,21 +32,160 @@ namespace M3DS {
                 inputFrames[inputFrameCount++] = Input::InputFrame{state};
         }
 
+        if (mInputListenerHoles || !mPendingInputListeners.empty())
+            refreshInputListeners();
 
-
-        const auto inputHelper = [&](this auto&& self, Node* node) -> void {
-            for (const auto& child : node->getChildren() | std::views::reverse)
-                self(child.get());
+        // Indexed, as listeners removed while handling input leave a null behind. The deepest and last drawn
+        // nodes, at the back of the tree order, see input first.
+        for (std::size_t i = mInputListeners.size(); i-- > 0;) {
+            bool unhandled = false;
 
             for (Input::InputFrame& inputFrame : std::span{inputFrames.begin(), inputFrameCount}) {
-                if (const auto script = node->getScript())
-                    script->input(inputFrame);
+                if (inputFrame.isHandled())
+                    continue;
+                unhandled = true;
 
-                node->input(inputFrame);
+                if (Node* node = mInputListeners[i]; node && node->getScript())
+                    node->getScript()->input(inputFrame);
+
+                if (Node* node = mInputListeners[i]; node && !inputFrame.isHandled())
+                    node->input(inputFrame);
             }
+
+            if (!unhandled)
+                break;
+        }
+    }
+
+    void Root::addInputListener(Node* node) {
+        node->mInputListener = true;
+        node->mInputPending = true;
+        node->mInputSlot = static_cast<std::uint32_t>(mPendingInputListeners.size());
+        mPendingInputListeners.emplace_back(node);
+    }
+
+    void Root::removeInputListener(Node* node) {
+        node->mInputListener = false;
+        if (!node->mInputPending) {
+            mInputListeners[node->mInputSlot] = nullptr;
+            ++mInputListenerHoles;
+            return;
+        }
+
+        node->mInputPending = false;
+        Node* last = mPendingInputListeners.back();
+        mPendingInputListeners[node->mInputSlot] = last;
+        last->mInputSlot = node->mInputSlot;
+        mPendingInputListeners.pop_back();
+    }
+
+    void Root::refreshInputListeners() {
+        // New listeners are sorted among themselves and merged in, in one pass that also drops removed ones,
+        // so the cost follows the number of listeners rather than the size of the tree.
+        std::ranges::sort(mPendingInputListeners, precedesInTree);
+        mMergedInputListeners.clear();
+        std::ranges::merge(
+            mInputListeners | std::views::filter([](const Node* node) { return node != nullptr; }),
+            mPendingInputListeners,
+            std::back_inserter(mMergedInputListeners),
+            precedesInTree
+        );
+        std::swap(mInputListeners, mMergedInputListeners);
+        mPendingInputListeners.clear();
+        mInputListenerHoles = 0;
+
+        for (std::uint32_t i{}; i < mInputListeners.size(); ++i) {
+            mInputListeners[i]->mInputSlot = i;
+            mInputListeners[i]->mInputPending = false;
+        }
+    }
+
+    bool Root::precedesInTree(const Node* lhs, const Node* rhs) noexcept {
+        const auto depth = [](const Node* node) {
+            std::size_t count {};
+            for (; node->mParent; node = node->mParent)
+                ++count;
+            return count;
         };
 
-        inputHelper(this);
+        std::size_t lhsDepth = depth(lhs);
+        std::size_t rhsDepth = depth(rhs);
+        const Node* lhsAncestor = lhs;
+        const Node* rhsAncestor = rhs;
+        for (; lhsDepth > rhsDepth; --lhsDepth)
+            lhsAncestor = lhsAncestor->mParent;
+        for (; rhsDepth > lhsDepth; --rhsDepth)
+            rhsAncestor = rhsAncestor->mParent;
+
+        // An ancestor comes before its descendants.
+        if (lhsAncestor == rhsAncestor)
+            return lhsAncestor == lhs && lhs != rhs;
+
+        while (lhsAncestor->mParent != rhsAncestor->mParent) {
+            lhsAncestor = lhsAncestor->mParent;
+            rhsAncestor = rhsAncestor->mParent;
+        }
+
+        // Searched from the back, where children added since the last merge are.
+        for (const std::unique_ptr<Node>& child : lhsAncestor->mParent->mChildren | std::views::reverse) {
+            if (child.get() == lhsAncestor)
+                return false;
+            if (child.get() == rhsAncestor)
+                return true;
+        }
+        return false;
+    }
+
+    std::span<Node* const> Root::getNodesInGroup(const std::string_view group) const noexcept {
+        const NodeName name = NodeName::find(group);
+        if (!name)
+            return {};
+
+        if (const auto it = mGroups.find(name); it != mGroups.end())
+            return it->second;
+        return {};
+    }
+
+    void Root::joinGroup(Node* node, Node::GroupMembership& membership) {
+        std::vector<Node*>& nodes = mGroups[membership.group];
+        membership.slot = static_cast<std::uint32_t>(nodes.size());
+        nodes.emplace_back(node);
+    }
+
+    void Root::leaveGroup(const Node* node, const Node::GroupMembership& membership) noexcept {
+        const auto it = mGroups.find(membership.group);
+        if (it == mGroups.end())
+            return;
+
+        std::vector<Node*>& nodes = it->second;
+        Node* moved = nodes.back();
+        nodes[membership.slot] = moved;
+        nodes.pop_back();
+
+        if (moved != node)
+            std::ranges::find(moved->getGroups(), membership.group, &Node::GroupMembership::group)->slot = membership.slot;
+    }
+
+    void Root::addInstance(Node* node) {
+        const TypeInfo& type = node->getTypeInfo();
+
+        auto [it, inserted] = mClassInstanceLookup.try_emplace(type.id, static_cast<std::uint16_t>(mClassInstances.size()));
+        if (inserted)
+            mClassInstances.emplace_back(&type);
+
+        std::vector<Node*>& nodes = mClassInstances[it->second].nodes;
+        node->mInstanceList = it->second;
+        node->mInstanceSlot = static_cast<std::uint32_t>(nodes.size());
+        nodes.emplace_back(node);
+    }
+
+    void Root::removeInstance(const Node* node) noexcept {
+        std::vector<Node*>& nodes = mClassInstances[node->mInstanceList].nodes;
+        Node* moved = nodes.back();
+        nodes[node->mInstanceSlot] = moved;
+        nodes.pop_back();
+
+        moved->mInstanceSlot = node->mInstanceSlot;
     }
 
     std::span<Viewport* const> Root::getViewports() noexcept {
@@ -68,6 +218,17 @@ namespace M3DS {
         });
     }
 
+    void Root::setPipelined(const bool pipelined) noexcept {
+        mPipelined = pipelined;
+
+        if (mPipelined && mUnrecordableNodes > 0)
+            Debug::warn("Root: {} nodes cannot be recorded, frames are drawn directly until they leave the tree", mUnrecordableNodes);
+    }
+
+    bool Root::isPipelined() const noexcept {
+        return mPipelined;
+    }
+
     void Root::addViewport(Viewport* viewport) {
         mViewports.emplace_back(viewport);
     }
@@ -76,16 +237,306 @@ namespace M3DS {
         std::erase(mViewports, viewport);
     }
 
+    void Root::addMeshInstance(MeshInstance* meshInstance) {
+        mMeshInstances.emplace_back(meshInstance);
+    }
+
+    void Root::removeMeshInstance(MeshInstance* meshInstance) {
+        std::erase(mMeshInstances, meshInstance);
+    }
+
     void Root::enableUpdate(Node* node) {
-        mUpdateList.emplace_back(node);
+        if (node->mUpdateSlot != noUpdateSlot || node->mProcessState != ProcessState::active)
+            return;
+
+        if (mUpdating) {
+            node->mUpdateBucket = pendingUpdateBucket;
+            node->mUpdateSlot = static_cast<std::uint32_t>(mPendingUpdates.size());
+            mPendingUpdates.emplace_back(node);
+        } else {
+            insertUpdate(node);
+        }
     }
 
     void Root::disableUpdate(Node* node) {
-        std::erase(mUpdateList, node);
+        if (node->mUpdateSlot == noUpdateSlot)
+            return;
+
+        if (node->mUpdateBucket == pendingUpdateBucket) {
+            mPendingUpdates[node->mUpdateSlot] = nullptr;
+        } else {
+            UpdateBucket& bucket = mUpdateBuckets[node->mUpdateBucket];
+            bucket.nodes[node->mUpdateSlot] = nullptr;
+            ++bucket.tombstones;
+        }
+        node->mUpdateSlot = noUpdateSlot;
+    }
+
+    void Root::insertUpdate(Node* node) {
+        const Node::UpdateRate rate = node->getUpdateRate();
+
+        std::uint8_t interval = 1;
+        if (rate == Node::UpdateRate::interval)
+            interval = node->getUpdateInterval();
+        else if (rate == Node::UpdateRate::distance)
+            interval = getLodInterval(node);
+
+        // Nodes whose exact class is unknown share a bucket with no class, which calls update virtually.
+        const std::string_view className = node->mExactClass ? node->getClass() : std::string_view{};
+        const std::uint16_t firstIdx = getUpdateBucket({ node->getProcessPriority(), rate, interval, className });
+
+        // Nothing would run for this node, so it never enters the update loop.
+        if (!mUpdateBuckets[firstIdx].batch.overridesUpdate && !node->mScript)
+            return;
+
+        // Joins the least populated phase, keeping every frame's share even.
+        std::uint16_t bucketIdx = firstIdx;
+        for (std::uint16_t idx = firstIdx; idx < firstIdx + interval; ++idx) {
+            const UpdateBucket& candidate = mUpdateBuckets[idx];
+            const UpdateBucket& best = mUpdateBuckets[bucketIdx];
+            if (candidate.nodes.size() - candidate.tombstones < best.nodes.size() - best.tombstones)
+                bucketIdx = idx;
+        }
+        UpdateBucket& bucket = mUpdateBuckets[bucketIdx];
+
+        node->mUpdateBucket = bucketIdx;
+        node->mUpdateSlot = static_cast<std::uint32_t>(bucket.nodes.size());
+        bucket.nodes.emplace_back(node);
+        if (rate == Node::UpdateRate::budgeted)
+            bucket.lastUpdates.emplace_back(mUpdateClock);
+    }
+
+    std::uint16_t Root::getUpdateBucket(const UpdateBucketKey& key) {
+        if (const auto it = mUpdateBucketLookup.find(key); it != mUpdateBucketLookup.end())
+            return it->second;
+
+        const auto& [priority, rate, interval, className] = key;
+        const auto firstIdx = static_cast<std::uint16_t>(mUpdateBuckets.size());
+
+        // Classes missing from the Registry keep virtual dispatch.
+        const std::optional<Registry::UpdateBatch> classBatch = Registry::getUpdateBatch(className);
+        if (!classBatch && !className.empty())
+            Debug::warn("{} is not registered, so its nodes update through virtual calls", className);
+        const Registry::UpdateBatch batch = classBatch.value_or(Registry::UpdateBatch{ virtualUpdateBatch, true });
+        for (std::uint8_t phase{}; phase < interval; ++phase) {
+            UpdateBucket& bucket = mUpdateBuckets.emplace_back(batch, priority);
+            bucket.rate = rate;
+            bucket.interval = interval;
+            bucket.phase = phase;
+        }
+        mUpdateBucketLookup.emplace(key, firstIdx);
+
+        // Buckets keep their index, only the order they run in is sorted.
+        auto it = std::ranges::upper_bound(mUpdateOrder, priority, {}, [this](const std::uint16_t idx) {
+            return mUpdateBuckets[idx].priority;
+        });
+        for (std::uint8_t phase{}; phase < interval; ++phase)
+            it = std::next(mUpdateOrder.insert(it, static_cast<std::uint16_t>(firstIdx + phase)));
+
+        return firstIdx;
+    }
+
+    void Root::budgetedUpdate(UpdateBucket& bucket) {
+        const std::size_t count = std::min<std::size_t>(mUpdateBudget, bucket.nodes.size());
+
+        for (std::size_t i{}; i < count; ++i) {
+            if (bucket.cursor >= bucket.nodes.size())
+                bucket.cursor = 0;
+
+            const std::uint32_t slot = bucket.cursor++;
+            if (!bucket.nodes[slot])
+                continue;
+
+            const auto elapsed = static_cast<Seconds<float>>(mUpdateClock - bucket.lastUpdates[slot]);
+            bucket.lastUpdates[slot] = mUpdateClock;
+            bucket.batch.func({ &bucket.nodes[slot], 1 }, elapsed);
+        }
+    }
+
+    bool Root::isUpdateDue(const Node& node) const noexcept {
+        if (node.mUpdateSlot != noUpdateSlot && node.mUpdateBucket != pendingUpdateBucket) {
+            const UpdateBucket& bucket = mUpdateBuckets[node.mUpdateBucket];
+            if (bucket.rate != Node::UpdateRate::budgeted)
+                return mUpdateFrame % bucket.interval == bucket.phase;
+
+            // Within the slots budgetedUpdate reaches this frame, wrapping past the end.
+            const std::size_t size = bucket.nodes.size();
+            const std::size_t cursor = bucket.cursor < size ? bucket.cursor : 0;
+            const std::size_t offset = (node.mUpdateSlot + size - cursor) % size;
+            return offset < std::min<std::size_t>(mUpdateBudget, size);
+        }
+
+        // Nodes outside the buckets are spread by their position among the live instances of their class.
+        std::size_t interval = 1;
+        switch (node.getUpdateRate()) {
+            case Node::UpdateRate::interval:
+                interval = node.getUpdateInterval();
+                break;
+            case Node::UpdateRate::distance:
+                interval = getLodInterval(&node);
+                break;
+            case Node::UpdateRate::budgeted: {
+                const std::size_t count = mClassInstances[node.mInstanceList].nodes.size();
+                interval = (count + mUpdateBudget - 1) / mUpdateBudget;
+                break;
+            }
+        }
+        return interval <= 1 || (mUpdateFrame + node.mInstanceSlot) % interval == 0;
+    }
+
+    void Root::refreshUpdateLods(const UpdateBucket& bucket) {
+        for (Node* node : bucket.nodes) {
+            if (node && getLodInterval(node) != bucket.interval) {
+                disableUpdate(node);
+                enableUpdate(node);
+            }
+        }
+    }
+
+    std::uint8_t Root::getLodInterval(const Node* node) const noexcept {
+        const auto* node3d = object_cast<const Node3D*>(node);
+        const Viewport* viewport = node->getViewport();
+        const Camera3D* camera = viewport ? viewport->getCamera3D() : nullptr;
+        if (!node3d || !camera || mUpdateLods.empty())
+            return 1;
+
+        const float distanceSquared = node3d->getGlobalTranslation().distanceSquaredTo(camera->getGlobalTranslation());
+        const auto it = std::ranges::find_if(mUpdateLods, [distanceSquared](const UpdateLod& lod) {
+            return distanceSquared <= lod.distance * lod.distance;
+        });
+        return it != mUpdateLods.end() ? it->interval : mUpdateLods.back().interval;
+    }
+
+    void Root::setUpdateBudget(const std::uint32_t nodes) noexcept {
+        mUpdateBudget = std::max<std::uint32_t>(nodes, 1);
+    }
+
+    std::uint32_t Root::getUpdateBudget() const noexcept {
+        return mUpdateBudget;
+    }
+
+    void Root::setUpdateLods(std::vector<UpdateLod> lods) {
+        for (UpdateLod& lod : lods)
+            lod.interval = std::max<std::uint8_t>(lod.interval, 1);
+        mUpdateLods = std::move(lods);
+    }
+
+    std::span<const Root::UpdateLod> Root::getUpdateLods() const noexcept {
+        return mUpdateLods;
+    }
+
+    void Root::virtualUpdateBatch(const std::span<Node* const> nodes, const Seconds<float> delta) {
+        for (Node* node : nodes) {
+            if (!node)
+                continue;
+
+            node->update(delta);
+            if (node->mScript)
+                node->mScript->update(delta);
+        }
+    }
+
+    void Root::disableUpdateSubtree(Node* node) {
+        for (Node& curr : node->walk<TreeOrder::preorder>())
+            disableUpdate(&curr);
+    }
+
+    void Root::compactUpdateBuckets() noexcept {
+        for (UpdateBucket& bucket : mUpdateBuckets) {
+            if (bucket.tombstones == 0)
+                continue;
+
+            const bool budgeted = bucket.rate == Node::UpdateRate::budgeted;
+            // The cursor follows the node it pointed at, or wraps if that was past the end.
+            std::uint32_t slot {};
+            std::uint32_t cursor {};
+            for (std::uint32_t i{}; i < bucket.nodes.size(); ++i) {
+                if (i == bucket.cursor)
+                    cursor = slot;
+
+                if (Node* node = bucket.nodes[i]) {
+                    node->mUpdateSlot = slot;
+                    bucket.nodes[slot] = node;
+                    if (budgeted)
+                        bucket.lastUpdates[slot] = bucket.lastUpdates[i];
+                    ++slot;
+                }
+            }
+
+            bucket.nodes.resize(slot);
+            if (budgeted) {
+                bucket.lastUpdates.resize(slot);
+                bucket.cursor = bucket.cursor < slot + bucket.tombstones ? cursor : 0;
+            }
+            bucket.tombstones = 0;
+        }
     }
 
     void Root::addToFreeQueue(Node* node) {
-        mFreeQueue.emplace(node);
+        mFreeQueue.emplace_back(node);
+    }
+
+    CallQueue& Root::getCallQueue() noexcept {
+        return mCallQueue;
+    }
+
+    TimerWheel& Root::getTimerWheel() noexcept {
+        return mTimerWheel;
+    }
+
+    const TimerWheel& Root::getTimerWheel() const noexcept {
+        return mTimerWheel;
+    }
+
+    TweenSystem& Root::getTweenSystem() noexcept {
+        return mTweenSystem;
+    }
+
+    const TweenSystem& Root::getTweenSystem() const noexcept {
+        return mTweenSystem;
+    }
+
+    CoroutineScheduler& Root::getCoroutineScheduler() noexcept {
+        return mCoroutineScheduler;
+    }
+
+    void Root::flushFreeQueue() {
+        if (mFreeQueue.empty())
+            return;
+
+        // Only nodes still under a parent in this tree are freed. Nodes queued under a queued ancestor go with it.
+        for (Node* node : mFreeQueue)
+            node->mFreeing = node->mParent && node->mRoot == this;
+        std::erase_if(mFreeQueue, [](const Node* node) {
+            for (const Node* ancestor = node->mParent; ancestor; ancestor = ancestor->mParent) {
+                if (ancestor->mFreeing)
+                    return true;
+            }
+            return !node->mFreeing;
+        });
+
+        // Grouped by parent, so each parent compacts its children once.
+        std::ranges::sort(mFreeQueue, [](const Node* lhs, const Node* rhs) {
+            if (lhs->mParent != rhs->mParent)
+                return std::less{}(lhs->mParent, rhs->mParent);
+            return std::less{}(lhs, rhs);
+        });
+        const auto duplicates = std::ranges::unique(mFreeQueue);
+        mFreeQueue.erase(duplicates.begin(), duplicates.end());
+
+        for (std::size_t i{}; i < mFreeQueue.size(); ++i) {
+            if (i == 0 || mFreeQueue[i]->mParent != mFreeQueue[i - 1]->mParent)
+                mFreeQueue[i]->mParent->detachFreeingChildren(mFreedSubtrees);
+        }
+        mFreeQueue.clear();
+
+        for (const std::unique_ptr<Node>& subtree : mFreedSubtrees) {
+            // The subtree has left the tree, so it is walked with this Root's scratch explicitly.
+            for (Node& curr : TreeWalk<Node, TreeOrder::preorder>{ subtree.get(), mWalkScratch })
+                curr.notification(Notification::tree_exited);
+        }
+
+        mFreedSubtrees.clear();
     }
 
     Failure Root::serialise([[maybe_unused]] Serialiser& serialiser) const noexcept {
@@ -96,12 +547,71 @@ namespace M3DS {
         return Failure{ ErrorCode::root_serialisation_disabled };
     }
 
+    void Root::animationUpdate(const Seconds<float> delta) noexcept {
+        mAnimationQueue.clear();
+
+        // Instances animate on the frames they would have updated on, by the time processed since.
+        for (MeshInstance* meshInstance : mMeshInstances) {
+            if (!meshInstance->isAnimationDue())
+                continue;
+
+            meshInstance->mAnimationElapsed += delta;
+            if (isUpdateDue(*meshInstance)) {
+                meshInstance->updateProgress(std::exchange(meshInstance->mAnimationElapsed, 0.f));
+                mAnimationQueue.emplace_back(meshInstance);
+            }
+        }
+
+        mWorkerPool.parallelFor(
+            mAnimationQueue.size(),
+            [this](const std::size_t idx) {
+                mAnimationQueue[idx]->updatePose();
+            }
+        );
+    }
+
     void Root::treeUpdate(const Seconds<float> delta) noexcept {
-        for (Node* node : mUpdateList) {
-            node->update(delta);
-            if (node->mScript)
-                node->mScript->update(delta);
+        compactUpdateBuckets();
+
+        ++mUpdateFrame;
+        mUpdateClock += delta;
+
+        animationUpdate(delta);
+
+        // Time moves on before anything runs, so timers started during the frame count from now.
+        mCoroutineScheduler.beginFrame();
+        mTimerWheel.advance(delta);
+
+        // Nodes enabled during the loop start updating next frame.
+        mUpdating = true;
+        for (const std::uint16_t bucketIdx : mUpdateOrder) {
+            UpdateBucket& bucket = mUpdateBuckets[bucketIdx];
+
+            if (bucket.rate == Node::UpdateRate::budgeted) {
+                budgetedUpdate(bucket);
+                continue;
+            }
+
+            bucket.elapsed += delta;
+            if (mUpdateFrame % bucket.interval != bucket.phase)
+                continue;
+
+            bucket.batch.func(bucket.nodes, std::exchange(bucket.elapsed, 0.f));
+            if (bucket.rate == Node::UpdateRate::distance)
+                refreshUpdateLods(bucket);
         }
+        mUpdating = false;
+
+        for (Node* node : mPendingUpdates) {
+            if (node) {
+                node->mUpdateSlot = noUpdateSlot;
+                insertUpdate(node);
+            }
+        }
+        mPendingUpdates.clear();
+
+        mCoroutineScheduler.resumeFrame();
+        mTweenSystem.advance(delta);
 
         mProcessLead += delta;
 
@@ -114,9 +624,17 @@ namespace M3DS {
                 viewport->physicsUpdate(physicsDelta);
             }
         }
+
+        mTransforms3D.update();
+        mTransforms2D.update();
     }
 
     void Root::treeDraw(const Draw draw) noexcept {
+        // Also kept when drawing directly, so the first pipelined frame after has something to record.
+        mDrawRequest = draw;
+        if (mFramePipelined)
+            return;
+
         for (Viewport* viewport : getViewports()) {
             viewport->clear();
             if (draw & Draw::draw_3d)
@@ -126,6 +644,27 @@ namespace M3DS {
         }
     }
 
+    void Root::recordSnapshot() {
+        mSnapshot.clear();
+        mSnapshotDraw = std::exchange(mDrawRequest, Draw::none);
+
+        if (mSnapshotDraw == Draw::none)
+            return;
+
+        for (Viewport* viewport : mViewports)
+            viewport->recordSnapshot(mSnapshot);
+    }
+
+    void Root::drawSnapshot() noexcept {
+        for (const RenderSnapshot::ViewportData& data : mSnapshot.getViewports()) {
+            data.viewport->clear();
+            if (mSnapshotDraw & Draw::draw_3d)
+                data.viewport->drawSnapshot3D(mSnapshot, data);
+            if (mSnapshotDraw & Draw::draw_2d)
+                data.viewport->drawSnapshot2D(data);
+        }
+    }
+
     REGISTER_METHODS(
         Root,
 
@@ -133,7 +672,8 @@ namespace M3DS {
         MUTABLE_METHOD(treeInput),
         MUTABLE_METHOD(exit),
         MUTABLE_METHOD(enableUpdate),
-        MUTABLE_METHOD(disableUpdate)
+        MUTABLE_METHOD(disableUpdate),
+        MUTABLE_METHOD(disableUpdateSubtree)
     );
 
     REGISTER_NO_MEMBERS(Root);
@@ -2,25 +2,32 @@
 
 namespace M3DS {
     void Timer::start() noexcept {
+        unschedule();
         mElapsed = 0;
         mActive = true;
+        schedule();
     }
 
     void Timer::restart() noexcept {
+        unschedule();
         mElapsed = 0;
+        schedule();
     }
 
     void Timer::pause() noexcept {
+        unschedule();
         mActive = false;
     }
 
     void Timer::stop() noexcept {
+        unschedule();
         mActive = false;
         mElapsed = 0;
     }
 
     void Timer::resume() noexcept {
         mActive = true;
+        schedule();
     }
 
     bool Timer::isActive() const noexcept {
@@ -28,11 +35,52 @@ namespace M3DS {
     }
 
     Seconds<float> Timer::getElapsed() const noexcept {
+        if (const TimerWheel* wheel = getTimerWheel(); wheel && mScheduled)
+            return duration - wheel->getTimeLeft(mScheduled);
         return mElapsed;
     }
 
     Seconds<float> Timer::getTimeLeft() const noexcept {
-        return duration - mElapsed;
+        return duration - getElapsed();
+    }
+
+    void Timer::notification(const Notification notification) {
+        // Leaving the tree or pausing keeps the elapsed time, to carry on from when the timer is scheduled again.
+        if (notification == Notification::tree_exited || notification == Notification::paused)
+            unschedule();
+
+        Node::notification(notification);
+
+        if (notification == Notification::tree_entered || notification == Notification::unpaused)
+            schedule();
+    }
+
+    void Timer::schedule() noexcept {
+        if (mScheduled || !mActive || !isProcessing())
+            return;
+
+        mScheduled = callAfter<&Timer::expire>(duration - mElapsed);
+    }
+
+    void Timer::unschedule() noexcept {
+        TimerWheel* wheel = getTimerWheel();
+        if (!mScheduled || !wheel)
+            return;
+
+        mElapsed = duration - wheel->getTimeLeft(mScheduled);
+        wheel->cancel(mScheduled);
+        mScheduled = {};
+    }
+
+    void Timer::expire() {
+        mScheduled = {};
+        mElapsed = 0;
+        if (oneShot)
+            mActive = false;
+        else
+            schedule();
+
+        timeout.emit();
     }
 
     Failure Timer::serialise(Serialiser& serialiser) const noexcept {
@@ -43,7 +91,7 @@ namespace M3DS {
             !serialiser.write(duration) ||
             !serialiser.write(oneShot) ||
             !serialiser.write(mActive) ||
-            !serialiser.write(mElapsed)
+            !serialiser.write(getElapsed())
         )
             return Failure{ ErrorCode::file_write_fail };
 
@@ -65,21 +113,6 @@ namespace M3DS {
         return timeout.deserialise(this, deserialiser);
     }
 
-    void Timer::update(const Seconds<float> delta) {
-        Node::update(delta);
-
-        if (mActive) {
-            mElapsed += delta;
-            if (mElapsed >= duration) {
-                if (oneShot)
-                    stop();
-                else
-                    mElapsed -= duration;
-                timeout.emit();
-            }
-        }
-    }
-
     REGISTER_METHODS(
         Timer,
 
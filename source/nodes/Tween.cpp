@@ -1,35 +1,55 @@
 #include <m3ds/nodes/Tween.hpp>
 
+#include <m3ds/nodes/Root.hpp>
+
 namespace M3DS {
+    void Tween::chain() noexcept {
+        if (TweenSystem* tweens = getTweenSystem())
+            tweens->chain(mSequence);
+    }
+
     bool Tween::isActive() const noexcept {
-        return mActive;
+        const TweenSystem* tweens = getTweenSystem();
+        return tweens && tweens->isRunning(mSequence);
     }
 
     void Tween::stop() noexcept {
-        mActive = false;
-    }
-
-    void Tween::update(const Seconds<float> delta) {
-        if (mActive) {
-            mElapsed += delta;
-
-            mTweenData.visit(
-                [&]<typename T>(const T& arg) {
-                    if (mElapsed >= mDuration) {
-                        arg.member->set(mTweenObject, arg.to);
-                        mActive = false;
-                        tweenComplete.emit();
-                    } else if constexpr (CanInterpolate<T>) {
-                        arg.member->set(
-                            mTweenObject,
-                            interpolate(arg.from, arg.to, mElapsed / mDuration, mMethod, mEasing)
-                        );
-                    }
-                }
-            );
+        if (TweenSystem* tweens = getTweenSystem())
+            tweens->kill(mSequence);
+        mSequence = {};
+    }
+
+    void Tween::notification(const Notification notification) {
+        if (notification == Notification::tree_exited)
+            stop();
+
+        Node::notification(notification);
+
+        if (notification == Notification::paused || notification == Notification::unpaused) {
+            if (TweenSystem* tweens = getTweenSystem())
+                tweens->setPaused(mSequence, notification == Notification::paused);
         }
+    }
+
+    TweenSystem* Tween::getTweenSystem() noexcept {
+        Root* root = getRoot();
+        return root ? &root->getTweenSystem() : nullptr;
+    }
+
+    const TweenSystem* Tween::getTweenSystem() const noexcept {
+        const Root* root = getRoot();
+        return root ? &root->getTweenSystem() : nullptr;
+    }
+
+    TweenSystem::Id Tween::getSequence(TweenSystem& tweens) noexcept {
+        if (tweens.isRunning(mSequence))
+            return mSequence;
 
-        Node::update(delta);
+        mSequence = tweens.create(*this, [](Node& owner) {
+            static_cast<Tween&>(owner).tweenComplete.emit();
+        });
+        tweens.setPaused(mSequence, !isProcessing());
+        return mSequence;
     }
 
     Failure Tween::serialise([[maybe_unused]] Serialiser& serialiser) const noexcept {
@@ -102,9 +102,36 @@ namespace M3DS {
         draw(target2d);
     }
 
-    void Viewport::treeDraw3D() noexcept {
+    template <typename DrawFunc>
+    void Viewport::drawStereo(const Matrix4x4* camera, const WorldEnvironment3D& worldEnv, DrawFunc&& drawFunc) noexcept {
         const float iod = osGet3DSliderState() / 3;
 
+        {
+            C3D_RenderTarget* lTarget = mTarget.getLeft();
+            C3D_FrameDrawOn(lTarget);
+            RenderTarget3D targetLeft { lTarget, mLightEnv, worldEnv };
+
+            if (camera)
+                targetLeft.setCameraPos(*camera);
+            targetLeft.prepare(-iod);
+            targetLeft.drawSkybox();
+
+            drawFunc(targetLeft);
+        }
+
+        if (C3D_RenderTarget* rTarget = mTarget.getRight(); rTarget && iod > 0) {
+            C3D_FrameDrawOn(rTarget);
+            RenderTarget3D targetRight { rTarget, mLightEnv, worldEnv };
+            if (camera)
+                targetRight.setCameraPos(*camera);
+            targetRight.prepare(iod);
+            targetRight.drawSkybox();
+
+            drawFunc(targetRight);
+        }
+    }
+
+    void Viewport::treeDraw3D() noexcept {
         for (unsigned int i{}; i < mLights.size(); ++i) {
             const auto& light = mLights[i];
 
@@ -118,31 +145,70 @@ namespace M3DS {
         }
         mLightEnv.bind();
 
-        {
-            C3D_RenderTarget* lTarget = mTarget.getLeft();
-            C3D_FrameDrawOn(lTarget);
-            RenderTarget3D targetLeft { lTarget, mLightEnv, mWorldEnv3D };
+        drawStereo(mCamera3D ? &mCamera3D->getGlobalTransform() : nullptr, mWorldEnv3D, [this](RenderTarget3D& target) {
+            draw(target);
+        });
+    }
 
-            if (mCamera3D)
-                targetLeft.setCameraPos(mCamera3D->getGlobalTransform());
-            targetLeft.prepare(-iod);
-            targetLeft.drawSkybox();
+    void Viewport::recordSnapshot(RenderSnapshot& snapshot) {
+        RenderSnapshot::ViewportData& data = snapshot.beginViewport(this);
 
-            draw(targetLeft);
+        if (mCamera3D)
+            data.camera3D = mCamera3D->getGlobalTransform();
+        if (mCamera2D)
+            data.camera2D = mCamera2D->getGlobalTransform().position;
+
+        for (std::size_t i{}; i < mLights.size(); ++i) {
+            if (const Light3D* light = mLights[i])
+                data.lights[i] = RenderSnapshot::LightData{ light->colour, light->getGlobalTranslation() };
         }
+        data.worldEnvironment = mWorldEnv3D;
 
-        if (C3D_RenderTarget* rTarget = mTarget.getRight(); rTarget && iod > 0) {
-            C3D_FrameDrawOn(rTarget);
-            RenderTarget3D targetRight { rTarget, mLightEnv, mWorldEnv3D };
-            if (mCamera3D)
-                targetRight.setCameraPos(mCamera3D->getGlobalTransform());
-            targetRight.prepare(iod);
-            targetRight.drawSkybox();
+        record(snapshot);
+    }
 
-            draw(targetRight);
+    void Viewport::drawSnapshot2D(const RenderSnapshot::ViewportData& data) noexcept {
+        RenderTarget2D target2d { mTarget.getLeft() };
+        target2d.prepare();
+
+        bool cameraSet = false;
+
+        for (const auto& [spriteSheet, transform, frame, centre, ignoreCamera] : data.sprites2D) {
+            if (const bool useCamera = data.camera2D && !ignoreCamera; useCamera != cameraSet) {
+                if (useCamera)
+                    target2d.setCameraPos(*data.camera2D);
+                else
+                    target2d.clearCamera();
+                cameraSet = useCamera;
+            }
+
+            target2d.drawTextureFrame(spriteSheet, transform, frame, centre);
         }
     }
 
+    void Viewport::drawSnapshot3D(const RenderSnapshot& snapshot, const RenderSnapshot::ViewportData& data) noexcept {
+        for (unsigned int i{}; i < data.lights.size(); ++i) {
+            const auto& light = data.lights[i];
+
+            auto& internal = mLightEnv.mLights[i];
+            if (light) {
+                internal.setColour(light->colour.x, light->colour.y, light->colour.z);
+                internal.setPosition(light->position);
+            } else {
+                internal.setColour(0, 0, 0);
+            }
+        }
+        mLightEnv.bind();
+
+        drawStereo(data.camera3D ? &*data.camera3D : nullptr, data.worldEnvironment, [&](RenderTarget3D& target) {
+            for (const RenderSnapshot::MeshCommand& mesh : data.meshes)
+                target.render(*mesh.mesh, mesh.transform, snapshot.getBones(mesh));
+
+            for (const auto& [spriteSheet, transform, frame, pixelSize, cullBack, billboard] : data.sprites3D)
+                target.drawSprite(spriteSheet, transform, frame, pixelSize, cullBack, billboard);
+        });
+    }
+
     bool Viewport::addLight(const Light3D* light) noexcept {
         for (auto& internalLight : mLights) {
             if (!internalLight) {
@@ -98,6 +98,11 @@ namespace M3DS {
         }
     }
 
+    // UI only draws directly, so trees containing it are never pipelined.
+    bool UINode::isRecordable() const noexcept {
+        return false;
+    }
+
     void UINode::shrinkToFit(const Vector2& size) noexcept {
         mSize = size;
         queueResize();
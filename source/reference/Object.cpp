@@ -10,12 +10,13 @@ namespace M3DS {
         return getClassStatic();
     }
 
-    bool Object::inheritsFromHashVirtual(const std::size_t fromClass) const noexcept {
-        return inheritsFromHash(fromClass);
+    const TypeInfo& Object::getTypeInfo() const noexcept {
+        return typeInfo<Object>;
     }
 
     bool Object::inherits(const std::string_view typeName) const noexcept {
-        return inheritsFromHashVirtual(fnv1a_hash(typeName));
+        const TypeInfo& info = getTypeInfo();
+        return std::ranges::contains(info.ancestors, info.ancestors + info.depth + 1, fnv1a_hash(typeName));
     }
 
     BoundMethodPair Object::getMethod(const std::string_view name) noexcept {
@@ -51,15 +52,7 @@ namespace M3DS {
             CONST_METHOD(getClass)
         };
 
-        for (const BoundMethodPair& pair : methods.getMethods()) {
-            const auto& [constMethod, mutableMethod] = pair;
-            if (
-                (constMethod && constMethod->getName() == name) ||
-                (mutableMethod && mutableMethod->getName() == name)
-            )
-                return pair;
-        }
-        return {};
+        return methods.find(name);
     }
 
     const GenericMember* Object::getMemberStatic(const std::string_view) noexcept {
@@ -0,0 +1,126 @@
+#include <m3ds/reference/resource/PackedScene.hpp>
+
+#include <limits>
+
+#include <m3ds/utils/binding/Registry.hpp>
+
+namespace M3DS {
+    Failure PackedScene::pack(const Node& node) noexcept {
+        mData.clear();
+        {
+            BinaryOutMemory memory { mData };
+            Serialiser serialiser { memory.getAccessor() };
+            if (const Failure failure = Registry::serialise(node, serialiser)) {
+                clear();
+                return failure;
+            }
+        }
+        mData.shrink_to_fit();
+
+        return record();
+    }
+
+    Failure PackedScene::pack(const std::filesystem::path& scenePath) noexcept {
+        BinaryInFile file { scenePath };
+        if (!file)
+            return Failure{ ErrorCode::file_open_fail };
+
+        const long length = file.length();
+        if (length <= 0)
+            return Failure{ ErrorCode::invalid_data };
+
+        mData.resize(static_cast<std::size_t>(length));
+        if (!file.read(std::span{mData})) {
+            clear();
+            return Failure{ ErrorCode::file_read_fail };
+        }
+
+        return record();
+    }
+
+    std::expected<std::unique_ptr<Node>, Failure> PackedScene::instantiate() const noexcept {
+        if (mData.empty())
+            return std::unexpected{ Failure{ ErrorCode::invalid_data } };
+
+        BinaryInMemory memory { mData };
+
+        // The deserialiser resolves signal connections when destroyed, so it must go before returning.
+        std::expected<std::unique_ptr<Node>, Failure> result = std::unexpected{ Failure{ ErrorCode::invalid_data } };
+        {
+            Deserialiser deserialiser { memory.getAccessor() };
+            deserialiser.replay(mCache);
+            result = Registry::deserialise<Node>(deserialiser);
+        }
+
+        return result;
+    }
+
+    Failure PackedScene::record() noexcept {
+        mCache = {};
+
+        BinaryInMemory memory { mData };
+
+        std::expected<std::unique_ptr<Node>, Failure> result = std::unexpected{ Failure{ ErrorCode::invalid_data } };
+        {
+            Deserialiser deserialiser { memory.getAccessor() };
+            deserialiser.record(mCache);
+            result = Registry::deserialise<Node>(deserialiser);
+        }
+
+        if (!result) {
+            clear();
+            return result.error();
+        }
+
+        return Success;
+    }
+
+    bool PackedScene::isEmpty() const noexcept {
+        return mData.empty();
+    }
+
+    std::size_t PackedScene::getSize() const noexcept {
+        return mData.size();
+    }
+
+    void PackedScene::clear() noexcept {
+        mData.clear();
+        mCache = {};
+    }
+
+    Failure PackedScene::serialise(Serialiser& serialiser) const noexcept {
+        if (const Failure failure = Resource::serialise(serialiser))
+            return failure;
+
+        if (mData.size() > std::numeric_limits<std::uint32_t>::max())
+            return Failure{ ErrorCode::out_of_bounds };
+
+        if (
+            !serialiser.write(static_cast<std::uint32_t>(mData.size())) ||
+            !serialiser.write(std::span{mData})
+        )
+            return Failure{ ErrorCode::file_write_fail };
+
+        return Success;
+    }
+
+    Failure PackedScene::deserialise(Deserialiser& deserialiser) noexcept {
+        if (const Failure failure = Resource::deserialise(deserialiser))
+            return failure;
+
+        std::uint32_t size;
+        if (!deserialiser.read(size))
+            return Failure{ ErrorCode::file_read_fail };
+
+        mData.resize(size);
+        if (!deserialiser.read(std::span{mData})) {
+            clear();
+            return Failure{ ErrorCode::file_read_fail };
+        }
+
+        return record();
+    }
+
+    REGISTER_NO_METHODS(PackedScene);
+    REGISTER_NO_MEMBERS(PackedScene);
+}
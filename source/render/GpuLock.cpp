@@ -0,0 +1,38 @@
+#include <m3ds/render/GpuLock.hpp>
+
+#ifdef __3DS__
+extern "C" {
+    #include <3ds/synchronization.h>
+}
+#else
+#include <mutex>
+#endif
+
+namespace M3DS {
+#ifdef __3DS__
+    // Initialised before main, while only one thread exists.
+    static RecursiveLock gpuLock = [] {
+        RecursiveLock lock;
+        RecursiveLock_Init(&lock);
+        return lock;
+    }();
+#else
+    static std::recursive_mutex gpuLock {};
+#endif
+
+    GpuLock::GpuLock() noexcept {
+#ifdef __3DS__
+        RecursiveLock_Lock(&gpuLock);
+#else
+        gpuLock.lock();
+#endif
+    }
+
+    GpuLock::~GpuLock() noexcept {
+#ifdef __3DS__
+        RecursiveLock_Unlock(&gpuLock);
+#else
+        gpuLock.unlock();
+#endif
+    }
+}
@@ -0,0 +1,74 @@
+#include <m3ds/render/RenderSnapshot.hpp>
+
+#include <cassert>
+
+namespace M3DS {
+    void RenderSnapshot::clear() noexcept {
+        for (ViewportData& data : std::span{ mViewports.data(), mViewportCount }) {
+            data.viewport = {};
+            data.camera3D.reset();
+            data.camera2D.reset();
+            data.lights.fill(std::nullopt);
+
+            data.meshes.clear();
+            data.sprites3D.clear();
+            data.sprites2D.clear();
+        }
+
+        mViewportCount = 0;
+        mBones.clear();
+    }
+
+    RenderSnapshot::ViewportData& RenderSnapshot::beginViewport(Viewport* viewport) {
+        if (mViewportCount == mViewports.size())
+            mViewports.emplace_back();
+
+        ViewportData& data = mViewports[mViewportCount++];
+        data.viewport = viewport;
+        return data;
+    }
+
+    void RenderSnapshot::addMesh(
+        const std::shared_ptr<const Mesh>& mesh,
+        const Matrix4x4& transform,
+        const std::span<const MeshInstance::BoneInstance> bones
+    ) {
+        current().meshes.emplace_back(mesh, transform, mBones.size(), bones.size());
+        for (const MeshInstance::BoneInstance& bone : bones)
+            mBones.emplace_back(bone.transform);
+    }
+
+    void RenderSnapshot::addSprite(
+        const SpriteSheet& spriteSheet,
+        const Matrix4x4& transform,
+        const std::uint32_t frame,
+        const float pixelSize,
+        const bool cullBack,
+        const bool billboard
+    ) {
+        current().sprites3D.emplace_back(spriteSheet, transform, frame, pixelSize, cullBack, billboard);
+    }
+
+    void RenderSnapshot::addSprite(
+        const SpriteSheet& spriteSheet,
+        const Transform2D& transform,
+        const std::uint32_t frame,
+        const bool centre,
+        const bool ignoreCamera
+    ) {
+        current().sprites2D.emplace_back(spriteSheet, transform, frame, centre, ignoreCamera);
+    }
+
+    std::span<const RenderSnapshot::ViewportData> RenderSnapshot::getViewports() const noexcept {
+        return { mViewports.data(), mViewportCount };
+    }
+
+    std::span<const Matrix4x4> RenderSnapshot::getBones(const MeshCommand& command) const noexcept {
+        return std::span{ mBones }.subspan(command.firstBone, command.boneCount);
+    }
+
+    RenderSnapshot::ViewportData& RenderSnapshot::current() noexcept {
+        assert(mViewportCount > 0);
+        return mViewports[mViewportCount - 1];
+    }
+}
@@ -657,28 +657,25 @@ namespace M3DS {
         C3D_CullFace(GPU_CULL_BACK_CCW);
     }
 
-    void RenderTarget3D::render(const MeshInstance& meshInstance) noexcept {
-        const Mesh* mesh = meshInstance.getMesh().get();
- 		if (!mesh) return;
-
+    template <typename BoneTransform>
+    void RenderTarget3D::renderMesh(const Mesh& mesh, const Matrix4x4& transform, const bool skinned, BoneTransform&& boneTransform) noexcept {
  		// Update the uniforms
-        program.updateUniform4x4(uniforms.modelView, mCameraInverse * meshInstance.getGlobalTransform());
+        program.updateUniform4x4(uniforms.modelView, mCameraInverse * transform);
 
-        const std::span<const MeshInstance::BoneInstance> boneInstances = meshInstance.getBones();
-        const std::span<const Mesh::Bone> bones = mesh->getBones();
+        const std::span<const Mesh::Bone> bones = mesh.getBones();
 
- 		for (const auto& [material, texture, triangles, boneMappings] : meshInstance.getMesh()->surfaces) {
+ 		for (const auto& [material, texture, triangles, boneMappings] : mesh.surfaces) {
             if (triangles.empty()) continue;
             // Configure the VBO
             C3D_BufInfo* bufInfo = C3D_GetBufInfo();
             BufInfo_Init(bufInfo);
             BufInfo_Add(bufInfo, triangles.data(), sizeof(Mesh::Vertex), 5, 0x43210);
 
- 			if (!boneInstances.empty()) {
+ 			if (skinned) {
  			    for (std::size_t i{}; i < boneMappings.size(); ++i) {
  			        program.updateUniform4x3(
                          static_cast<std::int8_t>(uniforms.bones + i * 3),
-                         boneInstances[boneMappings[i]].transform * bones[boneMappings[i]].inverseBindMatrix
+                         boneTransform(boneMappings[i]) * bones[boneMappings[i]].inverseBindMatrix
                      );
  			    }
  			}
@@ -690,6 +687,22 @@ namespace M3DS {
  		}
     }
 
+    void RenderTarget3D::render(const MeshInstance& meshInstance) noexcept {
+        if (const Mesh* mesh = meshInstance.getMesh().get()) {
+            const std::span<const MeshInstance::BoneInstance> boneInstances = meshInstance.getBones();
+
+            renderMesh(*mesh, meshInstance.getGlobalTransform(), !boneInstances.empty(), [&](const std::size_t bone) -> const Matrix4x4& {
+                return boneInstances[bone].transform;
+            });
+        }
+    }
+
+    void RenderTarget3D::render(const Mesh& mesh, const Matrix4x4& transform, const std::span<const Matrix4x4> bones) noexcept {
+        renderMesh(mesh, transform, !bones.empty(), [&](const std::size_t bone) -> const Matrix4x4& {
+            return bones[bone];
+        });
+    }
+
     void RenderTarget3D::drawSkybox() noexcept {
         if (mWorldEnv.skyboxTexture) {
             assert(scratchBuffer.getCurrentSpan().empty());
@@ -40,6 +40,7 @@ namespace M3DS {
 
         if (std::expected exp = Texture::load(path)) {
             mTexture = std::move(exp.value());
+            deserialiser.retain(std::make_shared<const Texture>(mTexture));
             setFrames(frameCount);
             return Success;
         } else {
@@ -2,6 +2,7 @@
 
 #include <flat_map>
 
+#include <m3ds/render/GpuLock.hpp>
 #include <m3ds/utils/BinaryFile.hpp>
 #include <m3ds/utils/Memory.hpp>
 #include <m3ds/utils/Path.hpp>
@@ -24,6 +25,8 @@ namespace M3DS {
     std::unordered_map<PathView, std::weak_ptr<TextureData>> textureRegistry {};
 
     TextureData::~TextureData() noexcept {
+        const GpuLock lock {};
+
         textureRegistry.erase(path.native());
         C3D_TexDelete(&native);
     }
@@ -48,6 +51,8 @@ namespace M3DS {
 
     // TODO: re-implement Tex3DS functions to remove extra heap allocation?
     std::expected<Texture, Failure> Texture::load(std::filesystem::path path, const bool vram) noexcept {
+        const GpuLock lock {};
+
         if (const auto it = textureRegistry.find(path.native()); it != textureRegistry.end()) {
             if (it->first == path) {
                 if (std::shared_ptr<TextureData> data = it->second.lock()) {
@@ -82,6 +87,8 @@ namespace M3DS {
     }
 
     std::expected<Texture, Failure> Texture::load(const std::span<const unsigned char> data, const bool vram) noexcept {
+        const GpuLock lock {};
+
         auto textureData = std::make_shared<TextureData>();
 
         Tex3DS_Texture_s* texture = Tex3DS_TextureImport(data.data(), data.size(), &textureData->native, nullptr, vram);
@@ -128,6 +135,7 @@ namespace M3DS {
 
         if (std::expected exp = load(path)) {
             *this = std::move(exp.value());
+            deserialiser.retain(mData);
             return Success;
         } else {
             return exp.error();
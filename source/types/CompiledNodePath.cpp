@@ -0,0 +1,46 @@
+#include <m3ds/types/CompiledNodePath.hpp>
+
+#include <algorithm>
+#include <cstddef>
+
+namespace M3DS {
+    CompiledNodePath::CompiledNodePath(const NodePath& path, const bool cached)
+        : mCached(cached)
+    {
+        std::ptrdiff_t depth {};
+
+        for (const std::string_view segment : path) {
+            if (segment == ".")
+                continue;
+
+            if (segment == "..") {
+                if (mSegments.empty()) {
+                    ++mParentHops;
+                } else {
+                    mSegments.emplace_back();
+                    if (--depth < 0)
+                        mAnchorHops = std::max(mAnchorHops, static_cast<std::size_t>(-depth));
+                }
+                continue;
+            }
+
+            if (segment.empty())
+                mUnresolvable = true;
+
+            mSegments.emplace_back(segment);
+            ++depth;
+        }
+    }
+
+    std::size_t CompiledNodePath::getParentHops() const noexcept {
+        return mParentHops;
+    }
+
+    std::span<const NodeName> CompiledNodePath::getSegments() const noexcept {
+        return mSegments;
+    }
+
+    bool CompiledNodePath::isCached() const noexcept {
+        return mCached;
+    }
+}
@@ -0,0 +1,26 @@
+#include <m3ds/types/NodeHandle.hpp>
+
+namespace M3DS {
+    std::uint32_t NodeHandle::acquire(Node* node) {
+        if (!mFreeSlots.empty()) {
+            const std::uint32_t index = mFreeSlots.back();
+            mFreeSlots.pop_back();
+            mSlots[index].node = node;
+            return index;
+        }
+
+        mSlots.emplace_back(node);
+        return static_cast<std::uint32_t>(mSlots.size() - 1);
+    }
+
+    NodeHandle NodeHandle::fromIndex(const std::uint32_t index) noexcept {
+        return { index, mSlots[index].generation };
+    }
+
+    void NodeHandle::release(const std::uint32_t index) noexcept {
+        Slot& slot = mSlots[index];
+        slot.node = nullptr;
+        ++slot.generation;
+        mFreeSlots.emplace_back(index);
+    }
+}
@@ -0,0 +1,51 @@
+#include <m3ds/types/NodeName.hpp>
+
+#include <deque>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace M3DS {
+    struct NameTable {
+        // std::deque never moves its elements, so views into the stored strings stay valid.
+        std::deque<std::string> storage {};
+        std::vector<std::string_view> names { std::string_view{} };
+        std::unordered_map<std::string_view, std::uint32_t> ids {};
+    };
+
+    static NameTable& getNameTable() {
+        static NameTable table {};
+        return table;
+    }
+
+    NodeName::NodeName(const std::string_view name) {
+        if (name.empty())
+            return;
+
+        NameTable& table = getNameTable();
+        if (const auto it = table.ids.find(name); it != table.ids.end()) {
+            mId = it->second;
+            return;
+        }
+
+        mId = static_cast<std::uint32_t>(table.names.size());
+
+        const std::string_view stored = table.storage.emplace_back(name);
+        table.names.emplace_back(stored);
+        table.ids.emplace(stored, mId);
+    }
+
+    NodeName NodeName::find(const std::string_view name) noexcept {
+        NodeName ret {};
+
+        const NameTable& table = getNameTable();
+        if (const auto it = table.ids.find(name); it != table.ids.end())
+            ret.mId = it->second;
+
+        return ret;
+    }
+
+    std::string_view NodeName::view() const noexcept {
+        return getNameTable().names[mId];
+    }
+}
@@ -0,0 +1,61 @@
+#include <m3ds/utils/CallQueue.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <numeric>
+
+#include <m3ds/nodes/Node.hpp>
+
+namespace M3DS {
+    void CallQueue::enqueue(const Call& call) {
+        mCalls.emplace_back(call);
+    }
+
+    void CallQueue::flush() {
+        std::swap(mCalls, mRunning);
+        coalesce();
+
+        // Indexed, as a call may cancel later ones but never grows mRunning.
+        for (std::size_t i{}; i < mRunning.size(); ++i) {
+            const Call& call = mRunning[i];
+            if (Node* target = call.target.get())
+                call.invoke(target, call.args.data());
+        }
+        mRunning.clear();
+    }
+
+    bool CallQueue::empty() const noexcept {
+        return mCalls.empty();
+    }
+
+    void CallQueue::coalesce() noexcept {
+        if (mRunning.size() < 2)
+            return;
+
+        const auto compare = [](const Call& lhs, const Call& rhs) -> int {
+            if (lhs.target != rhs.target)
+                return std::bit_cast<std::uint64_t>(lhs.target) < std::bit_cast<std::uint64_t>(rhs.target) ? -1 : 1;
+            if (lhs.invoke != rhs.invoke)
+                return std::bit_cast<std::uintptr_t>(lhs.invoke) < std::bit_cast<std::uintptr_t>(rhs.invoke) ? -1 : 1;
+            return std::memcmp(lhs.args.data(), rhs.args.data(), argCapacity);
+        };
+
+        // Sorting indices rather than calls keeps the order calls run in, and only the first of each duplicate survives.
+        mOrder.resize(mRunning.size());
+        std::iota(mOrder.begin(), mOrder.end(), std::uint32_t{});
+        std::ranges::sort(mOrder, [&](const std::uint32_t lhs, const std::uint32_t rhs) {
+            const int order = compare(mRunning[lhs], mRunning[rhs]);
+            return order != 0 ? order < 0 : lhs < rhs;
+        });
+
+        const Call* kept {};
+        for (const std::uint32_t idx : mOrder) {
+            Call& call = mRunning[idx];
+            if (kept && compare(*kept, call) == 0)
+                call.target = {};
+            else
+                kept = &call;
+        }
+    }
+}
@@ -0,0 +1,208 @@
+#include <m3ds/utils/Coroutine.hpp>
+
+#include <new>
+#include <tuple>
+
+#include <m3ds/nodes/Root.hpp>
+#include <m3ds/utils/NodePool.hpp>
+
+namespace M3DS {
+    void* Coroutine::promise_type::operator new(const std::size_t size) noexcept {
+        return NodePool::allocate(size);
+    }
+
+    void Coroutine::promise_type::operator delete(void* ptr, const std::size_t size) noexcept {
+        NodePool::deallocate(ptr, size);
+    }
+
+    Coroutine Coroutine::promise_type::get_return_object_on_allocation_failure() noexcept {
+        return {};
+    }
+
+    Coroutine Coroutine::promise_type::get_return_object() noexcept {
+        return Coroutine{ Handle::from_promise(*this) };
+    }
+
+    Coroutine::Coroutine(const Handle handle) noexcept
+        : mHandle(handle)
+    {}
+
+    Coroutine::~Coroutine() noexcept {
+        if (mHandle)
+            mHandle.destroy();
+    }
+
+    Coroutine::Coroutine(Coroutine&& other) noexcept
+        : mHandle(std::exchange(other.mHandle, {}))
+    {}
+
+    Coroutine& Coroutine::operator=(Coroutine&& other) noexcept {
+        if (this != &other) {
+            if (mHandle)
+                mHandle.destroy();
+            mHandle = std::exchange(other.mHandle, {});
+        }
+        return *this;
+    }
+
+    Coroutine::operator bool() const noexcept {
+        return static_cast<bool>(mHandle);
+    }
+
+    CoroutineScheduler::~CoroutineScheduler() noexcept {
+        for (const Entry& entry : mEntries) {
+            if (entry.handle)
+                entry.handle.destroy();
+        }
+    }
+
+    CoroutineId CoroutineScheduler::start(Node& owner, Coroutine coroutine) {
+        if (!coroutine || !owner.isInTree())
+            return {};
+
+        std::uint32_t index {};
+        if (!mFreeEntries.empty()) {
+            index = mFreeEntries.back();
+            mFreeEntries.pop_back();
+        } else {
+            index = static_cast<std::uint32_t>(mEntries.size());
+            mEntries.emplace_back();
+        }
+
+        Entry& entry = mEntries[index];
+        entry.handle = std::exchange(coroutine.mHandle, {});
+        entry.owner = &owner;
+        ++owner.mCoroutines;
+
+        const CoroutineId id { index, entry.generation };
+        Coroutine::promise_type& promise = entry.handle.promise();
+        promise.scheduler = this;
+        promise.owner = owner.getHandle();
+        promise.id = id;
+
+        resume(id);
+        return id;
+    }
+
+    void CoroutineScheduler::stop(const CoroutineId id) noexcept {
+        Entry* entry = find(id);
+        if (!entry)
+            return;
+
+        if (entry->running)
+            entry->stopping = true;
+        else
+            destroy(id.mIndex);
+    }
+
+    void CoroutineScheduler::cancel(const Node* owner) noexcept {
+        for (std::uint32_t i{}; i < mEntries.size(); ++i) {
+            Entry& entry = mEntries[i];
+            if (!entry.handle || entry.owner != owner)
+                continue;
+
+            // The owner may be destroyed before a running coroutine returns, so it is let go of now.
+            if (entry.running) {
+                entry.stopping = true;
+                --entry.owner->mCoroutines;
+                entry.owner = {};
+            } else {
+                destroy(i);
+            }
+        }
+    }
+
+    bool CoroutineScheduler::isRunning(const CoroutineId id) const noexcept {
+        const Entry* entry = find(id);
+        return entry && !entry->stopping;
+    }
+
+    void CoroutineScheduler::beginFrame() noexcept {
+        std::swap(mNextFrame, mResuming);
+    }
+
+    void CoroutineScheduler::resumeFrame() {
+        for (const CoroutineId id : mResuming)
+            resume(id);
+        mResuming.clear();
+    }
+
+    void CoroutineScheduler::resume(const CoroutineId id) {
+        Entry* entry = find(id);
+        if (!entry || entry->running || entry->stopping)
+            return;
+
+        // Paused owners hold their coroutines back, trying again each frame until they process.
+        if (!entry->owner->isProcessing()) {
+            waitFrame(id);
+            return;
+        }
+
+        const Coroutine::Handle handle = entry->handle;
+        entry->running = true;
+        handle.resume();
+
+        // Entries may have moved while the coroutine ran.
+        entry = &mEntries[id.mIndex];
+        entry->running = false;
+        if (handle.done() || entry->stopping)
+            destroy(id.mIndex);
+    }
+
+    void CoroutineScheduler::wake(const NodeHandle owner, const CoroutineId id) {
+        if (Node* node = owner.get()) {
+            if (Root* root = node->getRoot())
+                root->getCoroutineScheduler().resume(id);
+        }
+    }
+
+    void CoroutineScheduler::wakeTimer(Node* owner, const std::byte* args) {
+        const auto& [id] = *std::launder(reinterpret_cast<const std::tuple<CoroutineId>*>(args));
+
+        if (Root* root = owner->getRoot())
+            root->getCoroutineScheduler().resume(id);
+    }
+
+    void CoroutineScheduler::waitFrame(const CoroutineId id) {
+        mNextFrame.emplace_back(id);
+    }
+
+    auto CoroutineScheduler::find(const CoroutineId id) const noexcept -> const Entry* {
+        if (id.mIndex >= mEntries.size())
+            return {};
+
+        const Entry& entry = mEntries[id.mIndex];
+        return entry.handle && entry.generation == id.mGeneration ? &entry : nullptr;
+    }
+
+    auto CoroutineScheduler::find(const CoroutineId id) noexcept -> Entry* {
+        return const_cast<Entry*>(std::as_const(*this).find(id));
+    }
+
+    void CoroutineScheduler::destroy(const std::uint32_t index) noexcept {
+        Entry& entry = mEntries[index];
+        const Coroutine::Handle handle = std::exchange(entry.handle, {});
+
+        if (entry.owner)
+            --entry.owner->mCoroutines;
+        entry.owner = {};
+        entry.stopping = false;
+        ++entry.generation;
+        mFreeEntries.emplace_back(index);
+
+        handle.destroy();
+    }
+
+    void NextFrame::await_suspend(const Coroutine::Handle handle) const {
+        const Coroutine::promise_type& promise = handle.promise();
+        promise.scheduler->waitFrame(promise.id);
+    }
+
+    void WaitSeconds::await_suspend(const Coroutine::Handle handle) const {
+        const Coroutine::promise_type& promise = handle.promise();
+        if (Node* owner = promise.owner.get()) {
+            if (TimerWheel* wheel = owner->getTimerWheel())
+                wheel->schedule(delay, *owner, &CoroutineScheduler::wakeTimer, promise.id);
+        }
+    }
+}
@@ -0,0 +1,37 @@
+#include <m3ds/utils/EasingTable.hpp>
+
+#include <algorithm>
+
+namespace M3DS {
+    const std::array<EasingTable::Samples, EasingTable::sampledCurveCount> EasingTable::mSamples = [] {
+        std::array<Samples, sampledCurveCount> samples {};
+
+        for (auto method = std::to_underlying(InterpolationMethod::square); method <= std::to_underlying(InterpolationMethod::exponential); ++method) {
+            for (const Easing easing : { Easing::in, Easing::out, Easing::in_out }) {
+                const Curve curve = getCurve(static_cast<InterpolationMethod>(method), easing);
+                Samples& curveSamples = samples[curve - firstSampledCurve];
+
+                for (std::size_t i{}; i <= sampleCount; ++i) {
+                    const float progress = static_cast<float>(i) / static_cast<float>(sampleCount);
+                    curveSamples[i] = interpolate(0.f, 1.f, progress, static_cast<InterpolationMethod>(method), easing);
+                }
+            }
+        }
+        return samples;
+    }();
+
+    float EasingTable::sample(const Curve curve, const float progress) noexcept {
+        if (curve == discreteCurve)
+            return progress >= 1.f ? 1.f : 0.f;
+        if (curve == linearCurve)
+            return std::clamp(progress, 0.f, 1.f);
+
+        const Samples& samples = mSamples[curve - firstSampledCurve];
+
+        const float scaled = std::clamp(progress, 0.f, 1.f) * static_cast<float>(sampleCount);
+        const std::size_t idx = std::min(static_cast<std::size_t>(scaled), sampleCount - 1);
+        const float fraction = scaled - static_cast<float>(idx);
+
+        return samples[idx] + (samples[idx + 1] - samples[idx]) * fraction;
+    }
+}
@@ -0,0 +1,130 @@
+#include <m3ds/utils/NodePool.hpp>
+
+#include <algorithm>
+#include <array>
+#include <new>
+
+namespace M3DS {
+    struct SizePool {
+        std::vector<std::unique_ptr<std::byte[]>> slabs {};
+        void* freeList {};
+
+        std::size_t capacity {};
+        std::size_t used {};
+        std::size_t peak {};
+    };
+
+    static constexpr std::size_t minSlabObjects = 8;
+    static constexpr std::size_t maxSlabObjects = 256;
+
+    using SizePools = std::array<SizePool, NodePool::maxPooledSize / NodePool::granularity>;
+
+    static SizePools& getPools() noexcept {
+        // Never destroyed, as nodes owned by static objects may be freed after it would have been.
+        static SizePools& pools = *new SizePools{};
+        return pools;
+    }
+
+    static constexpr std::size_t getObjectSize(const std::size_t size) noexcept {
+        return (size + NodePool::granularity - 1) / NodePool::granularity * NodePool::granularity;
+    }
+
+    static SizePool& getPool(const std::size_t size) noexcept {
+        return getPools()[getObjectSize(size) / NodePool::granularity - 1];
+    }
+
+    static bool grow(SizePool& pool, const std::size_t objectSize, const std::size_t count) noexcept {
+        std::unique_ptr slab = std::unique_ptr<std::byte[]>(new (std::nothrow) std::byte[objectSize * count]);
+        if (!slab)
+            return false;
+
+        // Thread the new objects onto the free list back to front, so they are handed out in address order.
+        for (std::size_t i = count; i-- > 0;) {
+            void* object = slab.get() + i * objectSize;
+            *static_cast<void**>(object) = pool.freeList;
+            pool.freeList = object;
+        }
+
+        pool.slabs.emplace_back(std::move(slab));
+        pool.capacity += count;
+        return true;
+    }
+
+    void* NodePool::allocate(const std::size_t size) noexcept {
+        if (size > maxPooledSize)
+            return ::operator new(size, std::nothrow);
+
+        SizePool& pool = getPool(size);
+
+        // Each slab doubles the pool, so steady spawning settles without allocating.
+        if (!pool.freeList && !grow(pool, getObjectSize(size), std::clamp(pool.capacity, minSlabObjects, maxSlabObjects)))
+            return nullptr;
+
+        void* ptr = pool.freeList;
+        pool.freeList = *static_cast<void**>(ptr);
+
+        pool.peak = std::max(pool.peak, ++pool.used);
+        return ptr;
+    }
+
+    void NodePool::deallocate(void* ptr, const std::size_t size) noexcept {
+        if (!ptr)
+            return;
+
+        if (size > maxPooledSize) {
+            ::operator delete(ptr, size);
+            return;
+        }
+
+        SizePool& pool = getPool(size);
+        *static_cast<void**>(ptr) = pool.freeList;
+        pool.freeList = ptr;
+        --pool.used;
+    }
+
+    bool NodePool::reserve(const std::size_t size, const std::size_t count) noexcept {
+        if (size > maxPooledSize)
+            return true;
+
+        SizePool& pool = getPool(size);
+        if (pool.capacity - pool.used >= count)
+            return true;
+
+        return grow(pool, getObjectSize(size), count - (pool.capacity - pool.used));
+    }
+
+    NodePool::Stats NodePool::getStats(const std::size_t size) noexcept {
+        if (size > maxPooledSize)
+            return { .objectSize = size };
+
+        const SizePool& pool = getPool(size);
+        return {
+            .objectSize = getObjectSize(size),
+            .capacity = pool.capacity,
+            .used = pool.used,
+            .peak = pool.peak,
+            .slabs = pool.slabs.size()
+        };
+    }
+
+    std::vector<NodePool::Stats> NodePool::getAllStats() {
+        std::vector<Stats> stats {};
+
+        for (std::size_t i{}; i < getPools().size(); ++i) {
+            if (getPools()[i].peak > 0)
+                stats.emplace_back(getStats((i + 1) * granularity));
+        }
+
+        return stats;
+    }
+
+    void NodePool::trim() noexcept {
+        for (SizePool& pool : getPools()) {
+            if (pool.used == 0) {
+                pool.slabs.clear();
+                pool.freeList = nullptr;
+                pool.capacity = 0;
+            }
+        }
+    }
+}
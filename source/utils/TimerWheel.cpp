@@ -0,0 +1,173 @@
+#include <m3ds/utils/TimerWheel.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <utility>
+
+#include <m3ds/nodes/Node.hpp>
+
+namespace M3DS {
+    bool TimerWheel::cancel(const Id id) noexcept {
+        if (!find(id))
+            return false;
+
+        unlink(id.mIndex);
+        release(id.mIndex);
+        return true;
+    }
+
+    bool TimerWheel::isPending(const Id id) const noexcept {
+        return find(id) != nullptr;
+    }
+
+    Seconds<float> TimerWheel::getTimeLeft(const Id id) const noexcept {
+        const Timer* timer = find(id);
+        if (!timer)
+            return 0;
+
+        const float ticks = static_cast<float>(timer->expiry - mNow) - mTickFraction - timer->lateness;
+        return std::max(ticks, 0.f) / ticksPerSecond;
+    }
+
+    void TimerWheel::advance(const Seconds<float> delta) {
+        const float ticks = mTickFraction + std::max(delta, 0.f) * ticksPerSecond;
+        const auto whole = static_cast<std::uint64_t>(ticks);
+        const std::uint64_t target = mNow + whole;
+        mAdvanceTarget = target;
+        ++mAdvanceCount;
+
+        // Timers scheduled while firing count from the tick being run.
+        mTickFraction = 0;
+        while (mNow < target) {
+            ++mNow;
+
+            // Higher levels go first, as they may refile timers into the slot a lower level is about to cascade.
+            std::size_t levels = 1;
+            while (levels < levelCount && (mNow & ((std::uint64_t{ 1 } << (levels * slotBits)) - 1)) == 0)
+                ++levels;
+            for (std::size_t level = levels; level-- > 1;)
+                cascade(level);
+
+            expire();
+        }
+        mTickFraction = ticks - static_cast<float>(whole);
+    }
+
+    auto TimerWheel::insert(const Seconds<float> delay, Node& target, const Invoke invoke, const std::byte* args) -> Id {
+        std::uint32_t index = mFreeTimers;
+        if (index != noIndex) {
+            mFreeTimers = mTimers[index].next;
+        } else {
+            index = static_cast<std::uint32_t>(mTimers.size());
+            mTimers.emplace_back();
+        }
+
+        // Never early, and never on the tick being run. Timers scheduled while firing count from when the firing one was due.
+        static constexpr float maxTicks = 0x1p62f;
+        const float exact = (mFiring ? -mFiringLateness : mTickFraction) + delay * ticksPerSecond;
+        const float ticks = std::clamp(std::ceil(exact), 1.f, maxTicks);
+
+        Timer& timer = mTimers[index];
+        timer.expiry = mNow + static_cast<std::uint64_t>(ticks);
+        timer.lateness = std::clamp(ticks - exact, 0.f, 1.f);
+        timer.chainAdvance = mAdvanceCount;
+        timer.chainFires = mFiring ? static_cast<std::uint16_t>(mFiringChain + 1) : 0;
+
+        // Chains that would keep firing within this advance wait for the next one instead of catching up.
+        if (timer.chainFires >= maxChainFires && timer.expiry <= mAdvanceTarget) {
+            timer.expiry = mAdvanceTarget + 1;
+            timer.lateness = 0;
+        }
+        timer.target = target.getHandle();
+        timer.invoke = invoke;
+        std::memcpy(timer.args.data(), args, timer.args.size());
+        link(index);
+
+        return { index, timer.generation };
+    }
+
+    auto TimerWheel::find(const Id id) const noexcept -> const Timer* {
+        if (id.mIndex >= mTimers.size())
+            return {};
+
+        const Timer& timer = mTimers[id.mIndex];
+        return timer.invoke && timer.generation == id.mGeneration ? &timer : nullptr;
+    }
+
+    void TimerWheel::link(const std::uint32_t index) noexcept {
+        Timer& timer = mTimers[index];
+
+        // The highest bit where the expiry differs from now picks the level, so a timer is only
+        // reached once every lower level has wrapped around to it. Timers beyond the span of the wheel
+        // may reach their top slot early, and are refiled from there.
+        const std::uint64_t diff = timer.expiry ^ mNow;
+        const std::size_t level = std::min(static_cast<std::size_t>(std::bit_width(diff | 1) - 1) / slotBits, levelCount - 1);
+        const std::uint64_t slot = (timer.expiry >> (level * slotBits)) & (slotCount - 1);
+        timer.slot = static_cast<std::uint16_t>(level * slotCount + slot);
+
+        std::uint32_t& head = mSlots[timer.slot];
+        timer.prev = noIndex;
+        timer.next = head;
+        if (head != noIndex)
+            mTimers[head].prev = index;
+        head = index;
+    }
+
+    void TimerWheel::unlink(const std::uint32_t index) noexcept {
+        const Timer& timer = mTimers[index];
+
+        if (timer.prev != noIndex)
+            mTimers[timer.prev].next = timer.next;
+        else
+            mSlots[timer.slot] = timer.next;
+
+        if (timer.next != noIndex)
+            mTimers[timer.next].prev = timer.prev;
+    }
+
+    void TimerWheel::release(const std::uint32_t index) noexcept {
+        Timer& timer = mTimers[index];
+        timer.invoke = nullptr;
+        timer.target = {};
+        ++timer.generation;
+
+        timer.next = mFreeTimers;
+        mFreeTimers = index;
+    }
+
+    void TimerWheel::cascade(const std::size_t level) {
+        std::uint32_t& head = mSlots[level * slotCount + ((mNow >> (level * slotBits)) & (slotCount - 1))];
+
+        std::uint32_t index = std::exchange(head, noIndex);
+        while (index != noIndex) {
+            const std::uint32_t next = mTimers[index].next;
+            link(index);
+            index = next;
+        }
+    }
+
+    void TimerWheel::expire() {
+        // Everything in the current bottom slot is due now. Firing timers may cancel or schedule others,
+        // but never into this slot, so it is drained from the head.
+        const std::uint32_t& head = mSlots[mNow & (slotCount - 1)];
+
+        while (head != noIndex) {
+            const std::uint32_t index = head;
+            unlink(index);
+
+            // Copied out, as the call may schedule timers and grow mTimers.
+            const Timer timer = mTimers[index];
+            release(index);
+
+            if (Node* node = timer.target.get()) {
+                mFiring = true;
+                mFiringLateness = timer.lateness;
+                mFiringChain = timer.chainAdvance == mAdvanceCount ? timer.chainFires : 0;
+                timer.invoke(node, timer.args.data());
+                mFiring = false;
+            }
+        }
+    }
+}
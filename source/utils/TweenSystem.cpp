@@ -0,0 +1,132 @@
+#include <m3ds/utils/TweenSystem.hpp>
+
+#include <m3ds/nodes/Node.hpp>
+
+namespace M3DS {
+    auto TweenSystem::create(Node& owner, const Finished finished) -> Id {
+        std::uint32_t index {};
+        if (!mFreeSequences.empty()) {
+            index = mFreeSequences.back();
+            mFreeSequences.pop_back();
+        } else {
+            index = static_cast<std::uint32_t>(mSequences.size());
+            mSequences.emplace_back();
+        }
+
+        Sequence& sequence = mSequences[index];
+        const std::uint32_t generation = sequence.generation;
+        sequence = Sequence{ owner.getHandle(), finished };
+        sequence.generation = generation;
+        sequence.active = true;
+
+        return { index, generation };
+    }
+
+    void TweenSystem::chain(const Id sequence) noexcept {
+        if (Sequence* seq = find(sequence))
+            seq->stepStart = seq->stepEnd;
+    }
+
+    void TweenSystem::kill(const Id sequence) noexcept {
+        if (Sequence* seq = find(sequence))
+            seq->killed = true;
+    }
+
+    void TweenSystem::setPaused(const Id sequence, const bool paused) noexcept {
+        if (Sequence* seq = find(sequence))
+            seq->paused = paused;
+    }
+
+    bool TweenSystem::isRunning(const Id sequence) const noexcept {
+        const Sequence* seq = find(sequence);
+        return seq && !seq->killed;
+    }
+
+    void TweenSystem::advance(const Seconds<float> delta) {
+        for (Sequence& sequence : mSequences) {
+            if (!sequence.active)
+                continue;
+
+            if (!sequence.owner)
+                sequence.killed = true;
+            else if (!sequence.paused && !sequence.killed)
+                sequence.elapsed += delta;
+        }
+
+        std::apply([this](auto&... lanes) {
+            (advanceLane(lanes), ...);
+        }, mLanes);
+
+        finishSequences();
+    }
+
+    auto TweenSystem::find(const Id id) noexcept -> Sequence* {
+        return const_cast<Sequence*>(std::as_const(*this).find(id));
+    }
+
+    auto TweenSystem::find(const Id id) const noexcept -> const Sequence* {
+        if (id.mIndex >= mSequences.size())
+            return {};
+
+        const Sequence& sequence = mSequences[id.mIndex];
+        return sequence.active && sequence.generation == id.mGeneration ? &sequence : nullptr;
+    }
+
+    template <typename T>
+    void TweenSystem::advanceLane(Lane<T>& lane) {
+        // Indexed, as finished tweens are swapped out for the last one.
+        for (std::size_t i{}; i < lane.objects.size();) {
+            Sequence& sequence = mSequences[lane.sequences[i]];
+            if (sequence.killed) {
+                --sequence.remaining;
+                lane.swapRemove(i);
+                continue;
+            }
+
+            const Seconds<float> time = sequence.elapsed - lane.starts[i];
+            if (sequence.paused || time < 0.f) {
+                ++i;
+                continue;
+            }
+
+            if (!lane.started[i]) {
+                lane.from[i] = lane.members[i]->get(lane.objects[i]);
+                lane.started[i] = true;
+            }
+
+            const float progress = std::min(time * lane.inverseDurations[i], 1.f);
+            if (progress >= 1.f) {
+                lane.members[i]->set(lane.objects[i], lane.to[i]);
+                --sequence.remaining;
+                lane.swapRemove(i);
+                continue;
+            }
+
+            // Values that cannot be interpolated only change once the tween finishes.
+            if constexpr (CanInterpolate<T>) {
+                const float eased = EasingTable::sample(lane.curves[i], progress);
+                lane.members[i]->set(
+                    lane.objects[i],
+                    interpolate(static_cast<T>(lane.from[i]), static_cast<T>(lane.to[i]), eased, InterpolationMethod::linear, Easing::none)
+                );
+            }
+            ++i;
+        }
+    }
+
+    void TweenSystem::finishSequences() {
+        // Indexed, as finishing may create sequences.
+        for (std::size_t i{}; i < mSequences.size(); ++i) {
+            Sequence& sequence = mSequences[i];
+            if (!sequence.active || sequence.remaining != 0)
+                continue;
+
+            sequence.active = false;
+            ++sequence.generation;
+            mFreeSequences.emplace_back(static_cast<std::uint32_t>(i));
+
+            if (Node* owner = sequence.owner.get(); owner && !sequence.killed && sequence.finished)
+                sequence.finished(*owner);
+        }
+    }
+}
@@ -0,0 +1,184 @@
+#include <m3ds/utils/WorkerPool.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <span>
+
+#ifdef __3DS__
+extern "C" {
+    #include <3ds/svc.h>
+
+    // Main thread stack size, set by the application or libctru's default.
+    extern u32 __stacksize__;
+}
+#endif
+
+#include <m3ds/utils/Debug.hpp>
+
+namespace M3DS {
+#ifdef __3DS__
+    // The application core (0) runs the main thread. Core 2 only exists on the New 3DS, and
+    // core 1 is only usable if the application has been granted time on it, so both are optional.
+    static constexpr std::array<int, WorkerPool::maxWorkers> workerCores { 2, 1 };
+    // Launched tasks run what the main thread otherwise would, such as a pipelined simulation,
+    // so workers get at least the main thread's stack.
+    static constexpr std::size_t minWorkerStackSize = 64 * 1024;
+#endif
+
+    WorkerPool::Semaphore::Semaphore() noexcept {
+#ifdef __3DS__
+        LightSemaphore_Init(&mSemaphore, 0, INT16_MAX);
+#endif
+    }
+
+    void WorkerPool::Semaphore::acquire() noexcept {
+#ifdef __3DS__
+        LightSemaphore_Acquire(&mSemaphore, 1);
+#else
+        mSemaphore.acquire();
+#endif
+    }
+
+    void WorkerPool::Semaphore::release() noexcept {
+#ifdef __3DS__
+        LightSemaphore_Release(&mSemaphore, 1);
+#else
+        mSemaphore.release();
+#endif
+    }
+
+    WorkerPool::WorkerPool() noexcept {
+        for (Worker& worker : mWorkers)
+            worker.pool = this;
+
+#ifdef __3DS__
+        s32 priority = 0x30;
+        svcGetThreadPriority(&priority, CUR_THREAD_HANDLE);
+
+        const std::size_t stackSize = std::max<std::size_t>(__stacksize__, minWorkerStackSize);
+
+        for (const int core : workerCores) {
+            Worker& worker = mWorkers[mWorkerCount];
+            if ((worker.thread = threadCreate(workerMain, &worker, stackSize, priority, core, false)))
+                ++mWorkerCount;
+        }
+#else
+        const std::size_t hardwareThreads = std::thread::hardware_concurrency();
+        const std::size_t workerCount = std::min(maxWorkers, hardwareThreads > 1 ? hardwareThreads - 1 : 0);
+
+        for (; mWorkerCount < workerCount; ++mWorkerCount)
+            mWorkers[mWorkerCount].thread = std::thread{ workerMain, &mWorkers[mWorkerCount] };
+#endif
+
+        Debug::log<1>("WorkerPool started with {} workers", mWorkerCount);
+    }
+
+    WorkerPool::~WorkerPool() noexcept {
+        wait();
+        mStopping.store(true, std::memory_order_relaxed);
+
+        for (Worker& worker : std::span{ mWorkers.data(), mWorkerCount }) {
+            worker.start.release();
+#ifdef __3DS__
+            threadJoin(worker.thread, U64_MAX);
+            threadFree(worker.thread);
+#else
+            worker.thread.join();
+#endif
+        }
+    }
+
+    std::size_t WorkerPool::getWorkerCount() const noexcept {
+        return mWorkerCount;
+    }
+
+    void WorkerPool::wait() noexcept {
+        if (!mLaunchPending)
+            return;
+
+        mLaunched.done.acquire();
+        mLaunchPending = false;
+    }
+
+    void WorkerPool::dispatch(const JobFunc func, void* context, const std::size_t count) noexcept {
+        if (count == 0)
+            return;
+
+        Job& job = mCurrentWorker && mCurrentWorker->pool == this ? mCurrentWorker->dispatched : mDispatched;
+
+        // A parallelFor nested in one from the same thread runs on that thread alone.
+        if (job.active) {
+            for (std::size_t i{}; i < count; ++i)
+                func(context, i);
+            return;
+        }
+
+        job.active = true;
+        job.func = func;
+        job.context = context;
+        job.count = count;
+        job.next.store(0, std::memory_order_relaxed);
+        // The caller holds one count itself, so helpers finishing early never signal completion.
+        job.pending.store(1, std::memory_order_relaxed);
+
+        assign(job, count - 1);
+        runJob(job);
+
+        if (!finishJob(job))
+            job.done.acquire();
+        job.active = false;
+    }
+
+    bool WorkerPool::assign(Job& job, const std::size_t maxHelpers) noexcept {
+        std::size_t helpers {};
+
+        for (Worker& worker : std::span{ mWorkers.data(), mWorkerCount }) {
+            if (helpers == maxHelpers)
+                break;
+
+            bool expected = false;
+            if (!worker.busy.compare_exchange_strong(expected, true, std::memory_order_acquire))
+                continue;
+
+            job.pending.fetch_add(1, std::memory_order_relaxed);
+            worker.job = &job;
+            worker.start.release();
+            ++helpers;
+        }
+
+        return helpers > 0;
+    }
+
+    void WorkerPool::runJob(Job& job) noexcept {
+        for (
+            std::size_t i = job.next.fetch_add(1, std::memory_order_relaxed);
+            i < job.count;
+            i = job.next.fetch_add(1, std::memory_order_relaxed)
+        ) {
+            job.func(job.context, i);
+        }
+    }
+
+    bool WorkerPool::finishJob(Job& job) noexcept {
+        return job.pending.fetch_sub(1, std::memory_order_acq_rel) == 1;
+    }
+
+    void WorkerPool::workerMain(void* worker) noexcept {
+        auto& self = *static_cast<Worker*>(worker);
+        mCurrentWorker = &self;
+
+        while (true) {
+            self.start.acquire();
+            if (self.pool->mStopping.load(std::memory_order_relaxed))
+                return;
+
+            Job& job = *self.job;
+            runJob(job);
+
+            // Free the worker before signalling, so whoever waits on the job can claim it again straight away.
+            self.busy.store(false, std::memory_order_release);
+            if (finishJob(job))
+                job.done.release();
+        }
+    }
+}
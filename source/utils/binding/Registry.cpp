@@ -15,21 +15,34 @@ namespace M3DS {
         std::uint8_t classNameLength;
         if (!deserialiser.read(classNameLength))
             return std::unexpected{ Failure{ ErrorCode::file_read_fail } };
-        std::string className {};
-        className.resize(classNameLength);
-        if (!deserialiser.read(std::span{className}))
-            return std::unexpected{ Failure{ ErrorCode::file_read_fail } };
 
-        Debug::log<1>("Deserialising class: {}...", className);
-        const auto it = mRegistry.find(className);
-        if (it == mRegistry.end()) {
-            Debug::err("Unable to find class {} in Registry!", className);
-            return std::unexpected{ Failure{ ErrorCode::invalid_class_name } };
-        }
-        std::unique_ptr<Object> ptr = it->second.uniqueInstantiator();
-        if (!ptr) {
-            Debug::err("Class {} does not have a default unique constructor in the Registry!", className);
-            return std::unexpected{ Failure{ ErrorCode::non_default_constructible_class } };
+        std::unique_ptr<Object> ptr {};
+        if (deserialiser.isReplaying()) {
+            // The class was resolved when the cache was recorded, so its name is only skipped.
+            const ObjectInstantiator instantiator = deserialiser.replayClass();
+            if (!instantiator)
+                return std::unexpected{ Failure{ ErrorCode::invalid_data } };
+            if (!deserialiser.seek(classNameLength, std::ios_base::cur))
+                return std::unexpected{ Failure{ ErrorCode::file_read_fail } };
+            ptr = instantiator();
+        } else {
+            std::string className {};
+            className.resize(classNameLength);
+            if (!deserialiser.read(std::span{className}))
+                return std::unexpected{ Failure{ ErrorCode::file_read_fail } };
+
+            Debug::log<1>("Deserialising class: {}...", className);
+            const Entry* entry = findEntry(className);
+            if (!entry) {
+                Debug::err("Unable to find class {} in Registry!", className);
+                return std::unexpected{ Failure{ ErrorCode::invalid_class_name } };
+            }
+            ptr = entry->uniqueInstantiator();
+            if (!ptr) {
+                Debug::err("Class {} does not have a default unique constructor in the Registry!", className);
+                return std::unexpected{ Failure{ ErrorCode::non_default_constructible_class } };
+            }
+            deserialiser.recordClass(entry->uniqueInstantiator);
         }
 
         if (const Failure failure = ptr->deserialise(deserialiser))
@@ -51,6 +64,7 @@ namespace M3DS {
     }
 
     void Registry::clear() noexcept {
+        mTypeTable = {};
         mRegistry.clear();
     }
 }